@@ -0,0 +1,120 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/actor/actor.hpp>
+#include <mbgl/util/default_thread_pool.hpp>
+
+#include <future>
+#include <thread>
+#include <vector>
+
+using namespace mbgl;
+
+namespace {
+
+class Counter {
+public:
+    Counter(ActorRef<Counter>) {}
+
+    void receive(int i) {
+        sum += i;
+    }
+
+    void end(std::promise<void> promise) {
+        ::benchmark::DoNotOptimize(sum);
+        promise.set_value();
+    }
+
+private:
+    int sum = 0;
+};
+
+class Ping {
+public:
+    Ping(ActorRef<Ping> self_)
+        : self(std::move(self_)) {
+    }
+
+    void ping(int remaining, std::promise<void> promise) {
+        if (remaining == 0) {
+            promise.set_value();
+        } else {
+            self.invoke(&Ping::ping, remaining - 1, std::move(promise));
+        }
+    }
+
+private:
+    ActorRef<Ping> self;
+};
+
+const int messageCount = 10000;
+
+} // end namespace
+
+// Throughput of a single sender flooding a single actor.
+static void Actor_SingleSender(::benchmark::State& state) {
+    ThreadPool pool { 1 };
+    Actor<Counter> counter(pool);
+
+    while (state.KeepRunning()) {
+        for (int i = 0; i < messageCount; ++i) {
+            counter.invoke(&Counter::receive, i);
+        }
+
+        std::promise<void> promise;
+        std::future<void> future = promise.get_future();
+        counter.invoke(&Counter::end, std::move(promise));
+        future.wait();
+    }
+
+    state.SetItemsProcessed(state.iterations() * messageCount);
+}
+
+// Throughput of several threads sending to the same actor concurrently.
+static void Actor_MultipleSenders(::benchmark::State& state) {
+    const auto senders = state.range_x();
+
+    ThreadPool pool { 1 };
+    Actor<Counter> counter(pool);
+
+    while (state.KeepRunning()) {
+        std::vector<std::thread> threads;
+        for (auto sender = 0; sender < senders; ++sender) {
+            threads.emplace_back([&] () {
+                for (int i = 0; i < messageCount / senders; ++i) {
+                    counter.invoke(&Counter::receive, i);
+                }
+            });
+        }
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        std::promise<void> promise;
+        std::future<void> future = promise.get_future();
+        counter.invoke(&Counter::end, std::move(promise));
+        future.wait();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (messageCount / senders) * senders);
+}
+
+// Latency of an actor sending messages to itself, one at a time, like
+// `GeometryTileWorker::coalesce` does.
+static void Actor_SelfSend(::benchmark::State& state) {
+    ThreadPool pool { 1 };
+    Actor<Ping> ping(pool);
+
+    while (state.KeepRunning()) {
+        std::promise<void> promise;
+        std::future<void> future = promise.get_future();
+        ping.invoke(&Ping::ping, messageCount, std::move(promise));
+        future.wait();
+    }
+
+    state.SetItemsProcessed(state.iterations() * messageCount);
+}
+
+BENCHMARK(Actor_SingleSender)->UseRealTime();
+BENCHMARK(Actor_MultipleSenders)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+BENCHMARK(Actor_SelfSend)->UseRealTime();
@@ -0,0 +1,116 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/actor/actor.hpp>
+#include <mbgl/util/default_thread_pool.hpp>
+#include <mbgl/util/work_stealing_thread_pool.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+using namespace mbgl;
+
+namespace {
+
+// Tracks how many simulated tiles have finished their layout.
+class Completion {
+public:
+    void reset(std::size_t expected_) {
+        std::lock_guard<std::mutex> lock(mutex);
+        expected = expected_;
+        done = 0;
+    }
+
+    void signal() {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (++done == expected) {
+            cv.notify_one();
+        }
+    }
+
+    void wait() {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [this] { return done == expected; });
+    }
+
+private:
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::size_t expected = 0;
+    std::size_t done = 0;
+};
+
+// Mimics the message pattern of `GeometryTileWorker`: a "set" message triggers a chunk
+// of layout work followed by a self-sent "coalesced" message, after which placement
+// runs and the tile reports back.
+class TileWorker {
+public:
+    TileWorker(ActorRef<TileWorker> self_, Completion& completion_)
+        : self(std::move(self_)),
+          completion(completion_) {
+    }
+
+    void setData(uint32_t seed) {
+        layout(seed, 20000);
+        self.invoke(&TileWorker::coalesced);
+    }
+
+    void coalesced() {
+        layout(result, 5000);
+        completion.signal();
+    }
+
+private:
+    void layout(uint32_t seed, std::size_t iterations) {
+        uint32_t value = seed;
+        for (std::size_t i = 0; i < iterations; ++i) {
+            value = value * 1664525u + 1013904223u;
+        }
+        result = value;
+        ::benchmark::DoNotOptimize(result);
+    }
+
+    ActorRef<TileWorker> self;
+    Completion& completion;
+    uint32_t result = 0;
+};
+
+template <class Pool>
+void layoutTiles(::benchmark::State& state) {
+    const std::size_t tileCount = 256;
+
+    Pool pool(state.range_x());
+    Completion completion;
+
+    std::vector<std::unique_ptr<Actor<TileWorker>>> tiles;
+    for (std::size_t i = 0; i < tileCount; ++i) {
+        tiles.push_back(std::make_unique<Actor<TileWorker>>(pool, completion));
+    }
+
+    while (state.KeepRunning()) {
+        completion.reset(tileCount);
+        for (std::size_t i = 0; i < tileCount; ++i) {
+            tiles[i]->invoke(&TileWorker::setData, uint32_t(i));
+        }
+        completion.wait();
+    }
+
+    // Reported as items/second, i.e. tiles laid out per second.
+    state.SetItemsProcessed(state.iterations() * tileCount);
+}
+
+} // end namespace
+
+static void Scheduler_ThreadPool(::benchmark::State& state) {
+    layoutTiles<ThreadPool>(state);
+}
+
+static void Scheduler_WorkStealingThreadPool(::benchmark::State& state) {
+    layoutTiles<WorkStealingThreadPool>(state);
+}
+
+BENCHMARK(Scheduler_ThreadPool)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Arg(16)->UseRealTime();
+BENCHMARK(Scheduler_WorkStealingThreadPool)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Arg(16)->UseRealTime();
@@ -1,14 +1,21 @@
 #include <benchmark/benchmark.h>
 
+#include <mbgl/benchmark/util.hpp>
 #include <mbgl/style/filter.hpp>
 #include <mbgl/style/filter_evaluator.hpp>
+#include <mbgl/style/compiled_filter.hpp>
 #include <mbgl/style/rapidjson_conversion.hpp>
 #include <mbgl/style/conversion.hpp>
 #include <mbgl/style/conversion/filter.hpp>
 #include <mbgl/tile/geometry_tile_data.hpp>
+#include <mbgl/tile/vector_tile_data.hpp>
 
 #include <rapidjson/document.h>
 
+#include <string>
+#include <utility>
+#include <vector>
+
 using namespace mbgl;
 
 style::Filter parse(const char* expression) {
@@ -17,13 +24,13 @@ style::Filter parse(const char* expression) {
     return *style::conversion::convert<style::Filter>(doc);
 }
 
-static void Parse_Filter(benchmark::State& state) {
+static void Parse_Filter(::benchmark::State& state) {
     while (state.KeepRunning()) {
         parse(R"FILTER(["==", "foo", "bar"])FILTER");
     }
 }
 
-static void Parse_EvaluateFilter(benchmark::State& state) {
+static void Parse_EvaluateFilter(::benchmark::State& state) {
     const style::Filter filter = parse(R"FILTER(["==", "foo", "bar"])FILTER");
     const PropertyMap properties = { { "foo", std::string("bar") } };
 
@@ -37,5 +44,59 @@ static void Parse_EvaluateFilter(benchmark::State& state) {
     }
 }
 
+namespace {
+
+// Compound filters in the style of Mapbox Streets, paired with the source layer they apply to.
+std::vector<std::pair<std::string, style::Filter>> streetsFilters() {
+    return {
+        { "road", parse(R"FILTER(["all", ["==", "$type", "LineString"], ["in", "class", "motorway", "trunk", "primary", "secondary"], ["!in", "structure", "bridge", "tunnel"]])FILTER") },
+        { "road", parse(R"FILTER(["all", ["==", "$type", "LineString"], ["in", "class", "street", "street_limited", "service"], ["==", "structure", "none"]])FILTER") },
+        { "road", parse(R"FILTER(["any", ["==", "class", "path"], ["all", ["==", "class", "service"], ["==", "type", "driveway"]]])FILTER") },
+        { "building", parse(R"FILTER(["all", ["!=", "type", "building:part"], ["==", "underground", "false"]])FILTER") },
+        { "landuse", parse(R"FILTER(["any", ["in", "class", "park", "pitch", "cemetery"], ["==", "type", "playground"]])FILTER") },
+        { "poi_label", parse(R"FILTER(["all", ["<=", "localrank", 1], ["has", "name"], ["!in", "maki", "rail", "bus"]])FILTER") },
+        { "road_label", parse(R"FILTER(["all", ["==", "$type", "LineString"], ["in", "class", "motorway", "trunk", "primary"], ["<=", "len", 10000]])FILTER") },
+    };
+}
+
+} // end namespace
+
+// Evaluates every filter against every feature of its source layer, looking up each key
+// separately for every leaf of the filter.
+static void Parse_EvaluateFilterTile(::benchmark::State& state) {
+    const VectorTileData data(mbgl::benchmark::fixtureTile());
+    const auto filters = streetsFilters();
+
+    while (state.KeepRunning()) {
+        for (const auto& entry : filters) {
+            const GeometryTileLayer* layer = data.getLayer(entry.first);
+            for (std::size_t i = 0; i < layer->featureCount(); ++i) {
+                auto feature = layer->getFeature(i);
+                ::benchmark::DoNotOptimize(entry.second(feature->getType(), feature->getID(), [&] (const std::string& key) {
+                    return feature->getValue(key);
+                }));
+            }
+        }
+    }
+}
+
+// The same, but with the filters compiled against each layer first, as bucket layout does.
+static void Parse_EvaluateCompiledFilterTile(::benchmark::State& state) {
+    const VectorTileData data(mbgl::benchmark::fixtureTile());
+    const auto filters = streetsFilters();
+
+    while (state.KeepRunning()) {
+        for (const auto& entry : filters) {
+            const GeometryTileLayer* layer = data.getLayer(entry.first);
+            style::CompiledFilter filter(entry.second, *layer);
+            for (std::size_t i = 0; i < layer->featureCount(); ++i) {
+                ::benchmark::DoNotOptimize(filter(*layer->getFeature(i)));
+            }
+        }
+    }
+}
+
 BENCHMARK(Parse_Filter);
 BENCHMARK(Parse_EvaluateFilter);
+BENCHMARK(Parse_EvaluateFilterTile);
+BENCHMARK(Parse_EvaluateCompiledFilterTile);
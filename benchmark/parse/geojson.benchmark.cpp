@@ -0,0 +1,87 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/tile/geojson_tile_data.hpp>
+
+#include <cmath>
+
+using namespace mbgl;
+
+namespace {
+
+// A GeoJSON tile with a grid of polygons, each a circle with a hole, the way a large polygon
+// source like a set of parcels or building footprints looks after tiling.
+mapbox::geometry::feature_collection<int16_t> polygonTile(bool reversed) {
+    const int grid = 40;
+    const int vertices = 64;
+    const double cell = 8192.0 / grid;
+
+    auto circle = [&] (double cx, double cy, double radius, bool clockwise) {
+        mapbox::geometry::linear_ring<int16_t> ring;
+        for (int i = 0; i < vertices; ++i) {
+            const double angle = (clockwise ? -2 : 2) * M_PI * i / vertices;
+            ring.emplace_back(int16_t(std::round(cx + radius * std::cos(angle))),
+                              int16_t(std::round(cy + radius * std::sin(angle))));
+        }
+        ring.push_back(ring.front());
+        return ring;
+    };
+
+    mapbox::geometry::feature_collection<int16_t> features;
+    for (int x = 0; x < grid; ++x) {
+        for (int y = 0; y < grid; ++y) {
+            const double cx = (x + 0.5) * cell;
+            const double cy = (y + 0.5) * cell;
+
+            // Outer rings wind positively, holes negatively, unless `reversed`.
+            mapbox::geometry::polygon<int16_t> polygon;
+            polygon.push_back(circle(cx, cy, cell * 0.45, reversed));
+            polygon.push_back(circle(cx, cy, cell * 0.2, !reversed));
+
+            features.push_back({ polygon });
+        }
+    }
+    return features;
+}
+
+void readGeometries(const GeoJSONTileData& data) {
+    for (std::size_t i = 0; i < data.featureCount(); ++i) {
+        ::benchmark::DoNotOptimize(data.getFeature(i)->getGeometries());
+    }
+}
+
+} // end namespace
+
+// Polygons that are already valid skip Clipper.
+static void Parse_FixupPolygons_Valid(::benchmark::State& state) {
+    const auto features = polygonTile(false);
+
+    while (state.KeepRunning()) {
+        GeoJSONTileData data(features);
+        readGeometries(data);
+    }
+}
+
+// Polygons with the wrong winding order go through Clipper.
+static void Parse_FixupPolygons_Reversed(::benchmark::State& state) {
+    const auto features = polygonTile(true);
+
+    while (state.KeepRunning()) {
+        GeoJSONTileData data(features);
+        readGeometries(data);
+    }
+}
+
+// Reading the geometry again, as bucket layout, symbol layout and queries do, reuses the
+// polygons fixed by the first read.
+static void Parse_GeoJSONTile_RepeatedRead(::benchmark::State& state) {
+    const GeoJSONTileData data(polygonTile(true));
+    readGeometries(data);
+
+    while (state.KeepRunning()) {
+        readGeometries(data);
+    }
+}
+
+BENCHMARK(Parse_FixupPolygons_Valid);
+BENCHMARK(Parse_FixupPolygons_Reversed);
+BENCHMARK(Parse_GeoJSONTile_RepeatedRead);
@@ -0,0 +1,96 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/benchmark/util.hpp>
+#include <mbgl/geometry/feature_index.hpp>
+#include <mbgl/renderer/bucket.hpp>
+#include <mbgl/style/bucket_parameters.hpp>
+#include <mbgl/style/layer_impl.hpp>
+#include <mbgl/style/layers/fill_layer.hpp>
+#include <mbgl/style/layers/line_layer.hpp>
+#include <mbgl/tile/flat_geometry.hpp>
+#include <mbgl/tile/shared_buckets.hpp>
+#include <mbgl/tile/vector_tile_data.hpp>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+using namespace mbgl;
+using namespace mbgl::style;
+
+namespace {
+
+// The fixture tile is at z15; this is what zooming in to z20 lays out.
+const uint8_t minOverscaledZ = 15;
+const uint8_t maxOverscaledZ = 20;
+
+class OverzoomBenchmark {
+public:
+    OverzoomBenchmark() {
+        auto fill = std::make_unique<FillLayer>("building", "source");
+        fill->setSourceLayer("building");
+        layers.push_back(std::move(fill));
+
+        auto line = std::make_unique<LineLayer>("road", "source");
+        line->setSourceLayer("road");
+        line->setLineJoin(LineJoinType::Round);
+        layers.push_back(std::move(line));
+    }
+
+    // Builds the buckets of every layer for every overscaled tile of the fixture tile, reusing
+    // those that were already built for a previous level if `shared` is set.
+    void layout(SharedBuckets* shared) {
+        for (uint8_t z = minOverscaledZ; z <= maxOverscaledZ; ++z) {
+            const OverscaledTileID id(z, 15, 9648, 12318);
+            FeatureIndex featureIndex;
+
+            for (const auto& layer : layers) {
+                if (shared) {
+                    if (auto entry = shared->find(layer, id)) {
+                        featureIndex.insertBucket(*entry->featureIndex, layer->baseImpl->bucketName());
+                        continue;
+                    }
+                }
+
+                auto index = std::make_shared<FeatureIndex>();
+                BucketParameters parameters { id, obsolete, *index, MapMode::Still, buffers };
+                std::shared_ptr<Bucket> bucket = layer->baseImpl->createBucket(
+                    parameters, *data.getLayer(layer->baseImpl->sourceLayer));
+                featureIndex.insertBucket(*index, layer->baseImpl->bucketName());
+
+                if (shared) {
+                    shared->add(layer, id, { std::move(bucket), std::move(index) });
+                }
+            }
+        }
+    }
+
+    const VectorTileData data { mbgl::benchmark::fixtureTile() };
+    std::vector<std::shared_ptr<const Layer>> layers;
+    std::atomic<bool> obsolete { false };
+    GeometryBuffers buffers;
+};
+
+} // end namespace
+
+// Every overscaled level tessellates the same fills and lines again.
+static void Parse_Overzoom_Rebuild(::benchmark::State& state) {
+    OverzoomBenchmark bench;
+
+    while (state.KeepRunning()) {
+        bench.layout(nullptr);
+    }
+}
+
+// Only the first level builds buckets; the others share them.
+static void Parse_Overzoom_Shared(::benchmark::State& state) {
+    OverzoomBenchmark bench;
+
+    while (state.KeepRunning()) {
+        SharedBuckets shared;
+        bench.layout(&shared);
+    }
+}
+
+BENCHMARK(Parse_Overzoom_Rebuild);
+BENCHMARK(Parse_Overzoom_Shared);
@@ -0,0 +1,148 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/benchmark/util.hpp>
+#include <mbgl/tile/vector_tile_data.hpp>
+#include <mbgl/tile/flat_geometry.hpp>
+#include <mbgl/util/string.hpp>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace mbgl;
+
+namespace {
+
+// The ten source layers of the fixture tile.
+const std::vector<std::string> allLayers = {
+    "contour", "landuse", "barrier_line", "building", "landuse_overlay",
+    "road", "place_label", "rail_station_label", "poi_label", "road_label"
+};
+
+// What a style that only draws roads and their labels touches.
+const std::vector<std::string> someLayers = { "road", "road_label" };
+
+// Reads a property of every feature, as evaluating a filter would.
+void parse(const std::shared_ptr<const std::string>& tile, const std::vector<std::string>& names) {
+    VectorTileData data(tile);
+    for (const auto& name : names) {
+        const GeometryTileLayer* layer = data.getLayer(name);
+        for (std::size_t i = 0; i < layer->featureCount(); ++i) {
+            ::benchmark::DoNotOptimize(layer->getFeature(i)->getValue("class"));
+        }
+    }
+}
+
+#if defined(__GLIBC__)
+// The bytes currently allocated on the heap. mallinfo() is deprecated since glibc 2.33, and
+// its int fields overflow past 2 GiB.
+std::size_t allocatedBytes() {
+#if __GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33)
+    return mallinfo2().uordblks;
+#else
+    return static_cast<std::size_t>(mallinfo().uordblks);
+#endif
+}
+#endif
+
+// Reports the heap memory that a parsed tile holds on to, which is also its peak usage
+// since nothing is freed before the tile is destroyed.
+void reportMemory(::benchmark::State& state, const std::shared_ptr<const std::string>& tile,
+                  const std::vector<std::string>& names) {
+#if defined(__GLIBC__)
+    const std::size_t before = allocatedBytes();
+    {
+        VectorTileData data(tile);
+        for (const auto& name : names) {
+            data.getLayer(name);
+        }
+        const std::size_t after = allocatedBytes();
+        state.SetLabel(util::toString((after - before) / 1024) + " KiB");
+    }
+#else
+    (void)state;
+    (void)tile;
+    (void)names;
+#endif
+}
+
+// Decodes the geometry of every feature of every layer, with a feature object and geometry
+// allocated per feature.
+void decodeGeometries(const VectorTileData& data) {
+    for (const auto& name : allLayers) {
+        const GeometryTileLayer* layer = data.getLayer(name);
+        for (std::size_t i = 0; i < layer->featureCount(); ++i) {
+            ::benchmark::DoNotOptimize(layer->getFeature(i)->getGeometries());
+        }
+    }
+}
+
+// The same, reusing one feature object per layer and one flat geometry buffer throughout, as
+// bucket layout does.
+void readGeometries(const VectorTileData& data) {
+    FlatGeometry geometry;
+    for (const auto& name : allLayers) {
+        data.getLayer(name)->eachFeature([&] (const GeometryTileFeature& feature, std::size_t) {
+            feature.readGeometries(geometry);
+            ::benchmark::DoNotOptimize(geometry);
+            return true;
+        });
+    }
+}
+
+template <class Fn>
+void reportAllocations(::benchmark::State& state, const VectorTileData& data, Fn fn) {
+    const std::size_t before = mbgl::benchmark::allocationCount();
+    fn(data);
+    const std::size_t after = mbgl::benchmark::allocationCount();
+    state.SetLabel(util::toString(after - before) + " allocations/tile");
+}
+
+} // end namespace
+
+static void Parse_VectorTile_AllLayers(::benchmark::State& state) {
+    const auto tile = mbgl::benchmark::fixtureTile();
+    reportMemory(state, tile, allLayers);
+
+    while (state.KeepRunning()) {
+        parse(tile, allLayers);
+    }
+}
+
+static void Parse_VectorTile_SomeLayers(::benchmark::State& state) {
+    const auto tile = mbgl::benchmark::fixtureTile();
+    reportMemory(state, tile, someLayers);
+
+    while (state.KeepRunning()) {
+        parse(tile, someLayers);
+    }
+}
+
+static void Parse_VectorTile_Geometries(::benchmark::State& state) {
+    const VectorTileData data(mbgl::benchmark::fixtureTile());
+    decodeGeometries(data); // Decodes the layers themselves up front.
+    reportAllocations(state, data, decodeGeometries);
+
+    while (state.KeepRunning()) {
+        decodeGeometries(data);
+    }
+}
+
+static void Parse_VectorTile_ReadGeometries(::benchmark::State& state) {
+    const VectorTileData data(mbgl::benchmark::fixtureTile());
+    readGeometries(data);
+    reportAllocations(state, data, readGeometries);
+
+    while (state.KeepRunning()) {
+        readGeometries(data);
+    }
+}
+
+BENCHMARK(Parse_VectorTile_AllLayers);
+BENCHMARK(Parse_VectorTile_SomeLayers);
+BENCHMARK(Parse_VectorTile_Geometries);
+BENCHMARK(Parse_VectorTile_ReadGeometries);
@@ -0,0 +1,36 @@
+#include <mbgl/benchmark/util.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Replaces the global allocation functions in order to count allocations. The array and sized
+// forms all forward to these.
+
+namespace {
+
+std::atomic<std::size_t> count { 0 };
+
+} // namespace
+
+void* operator new(std::size_t size) {
+    count.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+namespace mbgl {
+namespace benchmark {
+
+std::size_t allocationCount() {
+    return count.load(std::memory_order_relaxed);
+}
+
+} // namespace benchmark
+} // namespace mbgl
@@ -3,6 +3,8 @@
 
 #include <mbgl/map/map.hpp>
 #include <mbgl/map/view.hpp>
+#include <mbgl/storage/offline_database.hpp>
+#include <mbgl/storage/resource.hpp>
 #include <mbgl/util/image.hpp>
 #include <mbgl/util/run_loop.hpp>
 
@@ -20,5 +22,13 @@ void render(Map& map, OffscreenView& view) {
     }
 }
 
+std::shared_ptr<const std::string> fixtureTile() {
+    OfflineDatabase db("benchmark/fixtures/api/cache.db");
+    auto response = db.get(Resource::tile(
+        "mapbox://tiles/mapbox.mapbox-terrain-v2,mapbox.mapbox-streets-v7/{z}/{x}/{y}.vector.pbf",
+        1.0, 9648, 12318, 15, Tileset::Scheme::XYZ));
+    return response->data;
+}
+
 } // namespace benchmark
 } // namespace mbgl
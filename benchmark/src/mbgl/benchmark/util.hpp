@@ -1,5 +1,9 @@
 #pragma once
 
+#include <cstddef>
+#include <memory>
+#include <string>
+
 namespace mbgl {
 
 class Map;
@@ -9,5 +13,12 @@ namespace benchmark {
 
 void render(Map&, OffscreenView&);
 
+// A Mapbox Streets v7 + Terrain v2 vector tile of Manhattan at z15, with ten source layers,
+// read from the offline database fixture.
+std::shared_ptr<const std::string> fixtureTile();
+
+// The number of times that operator new has been called so far in this process.
+std::size_t allocationCount();
+
 } // namespace benchmark
 } // namespace mbgl
@@ -0,0 +1,118 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/benchmark/util.hpp>
+#include <mbgl/storage/local_file_source.hpp>
+#include <mbgl/storage/mbtiles_file_source.hpp>
+#include <mbgl/storage/response.hpp>
+#include <mbgl/util/compression.hpp>
+#include <mbgl/util/io.hpp>
+#include <mbgl/util/run_loop.hpp>
+#include <mbgl/util/string.hpp>
+
+#include <sqlite3.hpp>
+
+#include <unistd.h>
+#include <limits.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace mbgl;
+
+namespace {
+
+// Every tile at z3.
+const int32_t zoom = 3;
+const int32_t tileCount = 64;
+
+std::string absolutePath(const std::string& fileName) {
+    char buff[PATH_MAX + 1];
+    return std::string(getcwd(buff, PATH_MAX + 1)) + "/" + fileName;
+}
+
+// A package or tile file written for the duration of a benchmark, holding the compressed
+// fixture tile as tile servers deliver it.
+class TemporaryFile {
+public:
+    TemporaryFile(std::string fileName) : path(absolutePath(fileName)) {}
+    ~TemporaryFile() { unlink(path.c_str()); }
+
+    const std::string path;
+};
+
+void writePackage(const std::string& path, const std::string& tile) {
+    unlink(path.c_str());
+    mapbox::sqlite::Database db(path, mapbox::sqlite::ReadWrite | mapbox::sqlite::Create);
+    db.exec("CREATE TABLE tiles (zoom_level INTEGER, tile_column INTEGER, tile_row INTEGER, tile_data BLOB)");
+    db.exec("CREATE UNIQUE INDEX tile_index ON tiles (zoom_level, tile_column, tile_row)");
+
+    mapbox::sqlite::Statement stmt = db.prepare("INSERT INTO tiles VALUES (?1, ?2, ?3, ?4)");
+    for (int32_t i = 0; i < tileCount; ++i) {
+        stmt.bind(1, zoom);
+        stmt.bind(2, i % (1 << zoom));
+        stmt.bind(3, i / (1 << zoom));
+        stmt.bindBlob(4, tile.data(), tile.size(), false);
+        stmt.run();
+        stmt.reset();
+    }
+}
+
+// Requests all URLs at once and waits for the responses, as a source loading a screenful of
+// tiles does.
+void requestAll(FileSource& fs, const std::vector<std::string>& urls) {
+    std::vector<std::unique_ptr<AsyncRequest>> requests;
+    std::size_t pending = urls.size();
+
+    for (const auto& url : urls) {
+        requests.push_back(fs.request({ Resource::Tile, url }, [&](Response res) {
+            ::benchmark::DoNotOptimize(res.data);
+            if (--pending == 0) {
+                util::RunLoop::Get()->stop();
+            }
+        }));
+    }
+
+    util::RunLoop::Get()->run();
+}
+
+} // end namespace
+
+static void Storage_MBTiles_Tiles(::benchmark::State& state) {
+    util::RunLoop loop;
+    TemporaryFile package("mbtiles_file_source.benchmark.mbtiles");
+    writePackage(package.path, util::compress(*mbgl::benchmark::fixtureTile()));
+
+    MBTilesFileSource fs;
+    std::vector<std::string> urls;
+    for (int32_t i = 0; i < tileCount; ++i) {
+        urls.push_back("mbtiles://" + package.path + "/" + util::toString(zoom) + "/" +
+                       util::toString(i % (1 << zoom)) + "/" + util::toString(i / (1 << zoom)) + ".pbf");
+    }
+
+    while (state.KeepRunning()) {
+        requestAll(fs, urls);
+    }
+
+    state.SetItemsProcessed(state.iterations() * tileCount);
+}
+
+// The same tiles read from individual files, as a local HTTP server fronting the package
+// would have to; this is the disk side of that path without the network round trip.
+static void Storage_LocalFile_Tiles(::benchmark::State& state) {
+    util::RunLoop loop;
+    TemporaryFile tile("mbtiles_file_source.benchmark.pbf");
+    util::write_file(tile.path, util::compress(*mbgl::benchmark::fixtureTile()));
+
+    LocalFileSource fs;
+    const std::vector<std::string> urls(tileCount, "file://" + tile.path);
+
+    while (state.KeepRunning()) {
+        requestAll(fs, urls);
+    }
+
+    state.SetItemsProcessed(state.iterations() * tileCount);
+}
+
+BENCHMARK(Storage_MBTiles_Tiles);
+BENCHMARK(Storage_LocalFile_Tiles);
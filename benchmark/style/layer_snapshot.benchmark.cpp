@@ -0,0 +1,128 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/style/style.hpp>
+#include <mbgl/style/layer.hpp>
+#include <mbgl/style/layer_impl.hpp>
+#include <mbgl/style/layers/fill_layer.hpp>
+#include <mbgl/style/layers/line_layer.hpp>
+#include <mbgl/style/layers/symbol_layer.hpp>
+#include <mbgl/storage/default_file_source.hpp>
+#include <mbgl/util/run_loop.hpp>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace mbgl;
+using namespace mbgl::style;
+
+namespace {
+
+const std::size_t tileCount = 40;
+const std::size_t layerCount = 120;
+
+// A style with `layerCount` filtered fill, line, and symbol layers, of which a single
+// layer is changed before every simulated relayout.
+class LayerSnapshotBenchmark {
+public:
+    LayerSnapshotBenchmark() {
+        for (std::size_t i = 0; i < layerCount; ++i) {
+            const std::string id = std::to_string(i);
+            const Filter filter = EqualsFilter { "class", id };
+
+            std::unique_ptr<Layer> layer;
+            switch (i % 3) {
+            case 0: {
+                auto fill = std::make_unique<FillLayer>(id, "source");
+                fill->setFilter(filter);
+                layer = std::move(fill);
+                break;
+            }
+            case 1: {
+                auto line = std::make_unique<LineLayer>(id, "source");
+                line->setFilter(filter);
+                line->setLineCap(LineCapType::Round);
+                layer = std::move(line);
+                break;
+            }
+            default: {
+                auto symbol = std::make_unique<SymbolLayer>(id, "source");
+                symbol->setFilter(filter);
+                symbol->setTextField(std::string("{name}"));
+                layer = std::move(symbol);
+                break;
+            }
+            }
+
+            style.addLayer(std::move(layer));
+        }
+    }
+
+    // Toggles the visibility of one layer, which invalidates its snapshot.
+    void changeStyle() {
+        Layer* layer = style.getLayers()[revision++ % layerCount];
+        layer->setVisibility(layer->getVisibility() == VisibilityType::Visible ? VisibilityType::None
+                                                                               : VisibilityType::Visible);
+    }
+
+    util::RunLoop loop;
+    DefaultFileSource fileSource { ":memory:", "." };
+    Style style { fileSource, 1 };
+    std::size_t revision = 0;
+};
+
+} // end namespace
+
+// Every tile gets its own deep copy of every layer on each relayout.
+static void Style_LayerClones(::benchmark::State& state) {
+    LayerSnapshotBenchmark bench;
+    std::size_t clones = 0;
+
+    while (state.KeepRunning()) {
+        bench.changeStyle();
+
+        for (std::size_t tile = 0; tile < tileCount; ++tile) {
+            std::vector<std::unique_ptr<Layer>> copies;
+            for (const Layer* layer : bench.style.getLayers()) {
+                copies.push_back(layer->baseImpl->clone());
+                clones++;
+            }
+            ::benchmark::DoNotOptimize(copies.data());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * tileCount * layerCount);
+    state.SetLabel(std::to_string(clones / state.iterations()) + " clones/relayout");
+}
+
+// All tiles share the snapshots; only the layer that changed is copied again.
+static void Style_LayerSnapshots(::benchmark::State& state) {
+    LayerSnapshotBenchmark bench;
+    std::unordered_map<const Layer*, std::shared_ptr<const Layer>> previous;
+    std::size_t clones = 0;
+
+    while (state.KeepRunning()) {
+        bench.changeStyle();
+
+        for (std::size_t tile = 0; tile < tileCount; ++tile) {
+            std::vector<std::shared_ptr<const Layer>> snapshots;
+            for (const Layer* layer : bench.style.getLayers()) {
+                snapshots.push_back(bench.style.getLayerSnapshot(*layer));
+
+                auto& last = previous[layer];
+                if (last != snapshots.back()) {
+                    last = snapshots.back();
+                    clones++;
+                }
+            }
+            ::benchmark::DoNotOptimize(snapshots.data());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * tileCount * layerCount);
+    state.SetLabel(std::to_string(clones / state.iterations()) + " clones/relayout");
+}
+
+BENCHMARK(Style_LayerClones);
+BENCHMARK(Style_LayerSnapshots);
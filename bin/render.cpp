@@ -5,7 +5,7 @@
 
 #include <mbgl/gl/headless_backend.hpp>
 #include <mbgl/gl/offscreen_view.hpp>
-#include <mbgl/util/default_thread_pool.hpp>
+#include <mbgl/util/elastic_thread_pool.hpp>
 #include <mbgl/storage/default_file_source.hpp>
 #include <mbgl/util/url.hpp>
 
@@ -86,8 +86,8 @@ int main(int argc, char *argv[]) {
 
     HeadlessBackend backend;
     OffscreenView view(backend.getContext(), { width * pixelRatio, height * pixelRatio });
-    ThreadPool threadPool(4);
-    Map map(backend, mbgl::Size { width, height }, pixelRatio, fileSource, threadPool, MapMode::Still);
+    auto threadPool = ElasticThreadPool::shared();
+    Map map(backend, mbgl::Size { width, height }, pixelRatio, fileSource, *threadPool, MapMode::Still);
 
     if (util::isURL(style_path)) {
         map.setStyleURL(style_path);
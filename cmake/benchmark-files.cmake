@@ -1,6 +1,10 @@
 # Do not edit. Regenerate this with ./scripts/generate-benchmark-files.sh
 
 set(MBGL_BENCHMARK_FILES
+    # actor
+    benchmark/actor/actor.benchmark.cpp
+    benchmark/actor/scheduler.benchmark.cpp
+
     # api
     benchmark/api/query.benchmark.cpp
 
@@ -9,12 +13,22 @@ set(MBGL_BENCHMARK_FILES
 
     # parse
     benchmark/parse/filter.benchmark.cpp
+    benchmark/parse/geojson.benchmark.cpp
+    benchmark/parse/overzoom.benchmark.cpp
+    benchmark/parse/vector_tile.benchmark.cpp
 
     # src
     benchmark/src/main.cpp
 
     # src/mbgl/benchmark
+    benchmark/src/mbgl/benchmark/allocations.cpp
     benchmark/src/mbgl/benchmark/benchmark.cpp
     benchmark/src/mbgl/benchmark/util.cpp
     benchmark/src/mbgl/benchmark/util.hpp
+
+    # storage
+    benchmark/storage/mbtiles_file_source.benchmark.cpp
+
+    # style
+    benchmark/style/layer_snapshot.benchmark.cpp
 )
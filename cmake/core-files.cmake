@@ -4,10 +4,16 @@ set(MBGL_CORE_FILES
     # actor
     src/mbgl/actor/actor.hpp
     src/mbgl/actor/actor_ref.hpp
+    src/mbgl/actor/fork_join.cpp
+    src/mbgl/actor/fork_join.hpp
     src/mbgl/actor/mailbox.cpp
     src/mbgl/actor/mailbox.hpp
     src/mbgl/actor/message.hpp
+    src/mbgl/actor/message_queue.cpp
+    src/mbgl/actor/message_queue.hpp
     src/mbgl/actor/scheduler.hpp
+    src/mbgl/actor/scheduler_statistics.cpp
+    src/mbgl/actor/scheduler_statistics.hpp
 
     # algorithm
     src/mbgl/algorithm/covered_by_children.hpp
@@ -199,6 +205,7 @@ set(MBGL_CORE_FILES
     src/mbgl/storage/asset_file_source.hpp
     src/mbgl/storage/http_file_source.hpp
     src/mbgl/storage/local_file_source.hpp
+    src/mbgl/storage/mbtiles_file_source.hpp
     src/mbgl/storage/network_status.cpp
     src/mbgl/storage/resource.cpp
     src/mbgl/storage/response.cpp
@@ -218,6 +225,8 @@ set(MBGL_CORE_FILES
     src/mbgl/style/cascade_parameters.hpp
     src/mbgl/style/class_dictionary.cpp
     src/mbgl/style/class_dictionary.hpp
+    src/mbgl/style/compiled_filter.cpp
+    src/mbgl/style/compiled_filter.hpp
     src/mbgl/style/cross_faded_property_evaluator.cpp
     src/mbgl/style/cross_faded_property_evaluator.hpp
     src/mbgl/style/function.cpp
@@ -350,18 +359,25 @@ set(MBGL_CORE_FILES
     src/mbgl/text/shaping.hpp
 
     # tile
+    src/mbgl/tile/flat_geometry.cpp
+    src/mbgl/tile/flat_geometry.hpp
     src/mbgl/tile/geojson_tile.cpp
     src/mbgl/tile/geojson_tile.hpp
+    src/mbgl/tile/geojson_tile_data.cpp
+    src/mbgl/tile/geojson_tile_data.hpp
     src/mbgl/tile/geometry_tile.cpp
     src/mbgl/tile/geometry_tile.hpp
     src/mbgl/tile/geometry_tile_data.cpp
     src/mbgl/tile/geometry_tile_data.hpp
     src/mbgl/tile/geometry_tile_worker.cpp
     src/mbgl/tile/geometry_tile_worker.hpp
+    src/mbgl/tile/layout_counters.hpp
     src/mbgl/tile/raster_tile.cpp
     src/mbgl/tile/raster_tile.hpp
     src/mbgl/tile/raster_tile_worker.cpp
     src/mbgl/tile/raster_tile_worker.hpp
+    src/mbgl/tile/shared_buckets.cpp
+    src/mbgl/tile/shared_buckets.hpp
     src/mbgl/tile/tile.cpp
     src/mbgl/tile/tile.hpp
     src/mbgl/tile/tile_cache.cpp
@@ -370,12 +386,19 @@ set(MBGL_CORE_FILES
     src/mbgl/tile/tile_id_io.cpp
     src/mbgl/tile/tile_loader.hpp
     src/mbgl/tile/tile_loader_impl.hpp
+    src/mbgl/tile/tile_memory_manager.cpp
+    src/mbgl/tile/tile_memory_manager.hpp
     src/mbgl/tile/tile_observer.hpp
     src/mbgl/tile/vector_tile.cpp
     src/mbgl/tile/vector_tile.hpp
+    src/mbgl/tile/vector_tile_data.cpp
+    src/mbgl/tile/vector_tile_data.hpp
+    src/mbgl/tile/vector_tile_data_cache.cpp
+    src/mbgl/tile/vector_tile_data_cache.hpp
 
     # util
     include/mbgl/util/async_request.hpp
+    include/mbgl/util/byte_buffer.hpp
     include/mbgl/util/char_array_buffer.hpp
     include/mbgl/util/chrono.hpp
     include/mbgl/util/color.hpp
@@ -391,7 +414,9 @@ set(MBGL_CORE_FILES
     include/mbgl/util/geojson.hpp
     include/mbgl/util/geometry.hpp
     include/mbgl/util/image.hpp
+    include/mbgl/util/layout_statistics.hpp
     include/mbgl/util/logging.hpp
+    include/mbgl/util/memory_usage.hpp
     include/mbgl/util/noncopyable.hpp
     include/mbgl/util/optional.hpp
     include/mbgl/util/platform.hpp
@@ -410,6 +435,7 @@ set(MBGL_CORE_FILES
     include/mbgl/util/work_task.hpp
     include/mbgl/util/work_task_impl.hpp
     src/mbgl/util/async_task.hpp
+    src/mbgl/util/byte_buffer.cpp
     src/mbgl/util/chrono.cpp
     src/mbgl/util/clip_id.cpp
     src/mbgl/util/clip_id.hpp
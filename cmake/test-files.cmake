@@ -4,6 +4,8 @@ set(MBGL_TEST_FILES
     # actor
     test/actor/actor.test.cpp
     test/actor/actor_ref.test.cpp
+    test/actor/fork_join.test.cpp
+    test/actor/scheduler_statistics.test.cpp
 
     # algorithm
     test/algorithm/covered_by_children.test.cpp
@@ -65,11 +67,13 @@ set(MBGL_TEST_FILES
     test/storage/headers.test.cpp
     test/storage/http_file_source.test.cpp
     test/storage/local_file_source.test.cpp
+    test/storage/mbtiles_file_source.test.cpp
     test/storage/offline.test.cpp
     test/storage/offline_database.test.cpp
     test/storage/offline_download.test.cpp
     test/storage/online_file_source.test.cpp
     test/storage/resource.test.cpp
+    test/storage/response_cache.test.cpp
 
     # style/conversion
     test/style/conversion/geojson_options.test.cpp
@@ -88,14 +92,19 @@ set(MBGL_TEST_FILES
     test/text/quads.test.cpp
 
     # tile
+    test/tile/flat_geometry.test.cpp
     test/tile/geometry_tile_data.test.cpp
     test/tile/raster_tile.test.cpp
+    test/tile/shared_buckets.test.cpp
+    test/tile/tile_cache.test.cpp
     test/tile/tile_coordinate.test.cpp
     test/tile/tile_id.test.cpp
     test/tile/vector_tile.test.cpp
 
     # util
     test/util/async_task.test.cpp
+    test/util/byte_buffer.test.cpp
+    test/util/elastic_thread_pool.test.cpp
     test/util/geo.test.cpp
     test/util/http_timeout.test.cpp
     test/util/image.test.cpp
@@ -114,4 +123,5 @@ set(MBGL_TEST_FILES
     test/util/token.test.cpp
     test/util/url.test.cpp
     test/util/work_queue.test.cpp
+    test/util/work_stealing_thread_pool.test.cpp
 )
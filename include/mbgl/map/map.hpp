@@ -7,6 +7,8 @@
 #include <mbgl/util/feature.hpp>
 #include <mbgl/util/noncopyable.hpp>
 #include <mbgl/util/size.hpp>
+#include <mbgl/util/memory_usage.hpp>
+#include <mbgl/util/layout_statistics.hpp>
 #include <mbgl/annotation/annotation.hpp>
 #include <mbgl/style/transition_options.hpp>
 
@@ -15,6 +17,7 @@
 #include <functional>
 #include <vector>
 #include <memory>
+#include <unordered_map>
 
 namespace mbgl {
 
@@ -186,9 +189,35 @@ public:
     AnnotationIDs queryPointAnnotations(const ScreenBox&);
 
     // Memory
+    // Tiles that are no longer displayed are kept in case they are needed again, within two
+    // limits. `setSourceTileCacheSize` caps the number of such tiles that each source keeps,
+    // and is unlimited unless set. `setTileCacheBytes` caps the memory, in bytes, that all
+    // sources spend on them together. A tile is kept only while both limits hold: a source
+    // evicts its oldest tile once it exceeds its count, and the least recently cached tiles
+    // of any source are evicted once the sources exceed the byte budget.
     void setSourceTileCacheSize(size_t);
+    void setTileCacheBytes(size_t);
+    // The GPU memory that the map may use for buffers, textures and renderbuffers. Above it,
+    // cached tiles release their GPU resources, least recently used first, and upload them
+    // again if they are displayed again. Tiles that are displayed are never affected.
+    void setGPUMemoryBudget(size_t);
+    size_t getGPUMemoryBudget() const;
+    // The memory currently taken up by the tiles of each source, by source ID. Data and buckets
+    // that tiles share are split evenly between them.
+    std::unordered_map<std::string, SourceMemoryUsage> getSourceMemoryUsage() const;
+    // Frees memory that can be recreated later on, more of it the higher the pressure. The
+    // map isn't rerendered after `MemoryPressure::Background`, which expects that nothing is
+    // displayed until the map is rendered again.
+    void onMemoryPressure(MemoryPressure);
+    // Same as `onMemoryPressure(MemoryPressure::Critical)`.
     void onLowMemory();
 
+    // Layout
+    // The minimum number of features a tile layout has to process before its buckets are
+    // built in parallel. Applies to tiles loaded afterwards.
+    void setParallelLayoutThreshold(size_t);
+    size_t getParallelLayoutThreshold() const;
+
     // Debug
     void setDebug(MapDebugOptions);
     void cycleDebugOptions();
@@ -197,6 +226,19 @@ public:
     bool isFullyLoaded() const;
     void dumpDebugLogs() const;
 
+    // Instrumentation of the scheduler that the map's workers run on, if it supports any:
+    // wait and execution times of messages, queue depths and worker utilization. Collecting
+    // them has a cost, so they are off until enabled; with `sampleInterval`, only one in that
+    // many events is recorded.
+    void enableSchedulerStatistics(size_t sampleInterval = 1);
+    void disableSchedulerStatistics();
+    // The statistics collected so far, as JSON, or an empty string if the scheduler doesn't
+    // support them.
+    std::string getSchedulerStatistics() const;
+    // The tile layouts and placements that ran to completion, and that were abandoned midway
+    // because their tile became obsolete, since the current style was loaded.
+    LayoutStatistics getLayoutStatistics() const;
+
 private:
     class Impl;
     const std::unique_ptr<Impl> impl;
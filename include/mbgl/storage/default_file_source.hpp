@@ -12,6 +12,19 @@ namespace util {
 template <typename T> class Thread;
 } // namespace util
 
+// How well the in-memory cache of the default file source has served requests so far.
+class ResponseCacheStats {
+public:
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    std::size_t bytes = 0;
+    std::size_t entries = 0;
+
+    double hitRate() const {
+        return hits + misses ? double(hits) / (hits + misses) : 0;
+    }
+};
+
 class DefaultFileSource : public FileSource {
 public:
     /*
@@ -29,6 +42,8 @@ public:
     bool supportsOptionalRequests() const override {
         return true;
     }
+
+    void onMemoryPressure(MemoryPressure) override;
     
     void setAPIBaseURL(const std::string&);
     std::string getAPIBaseURL() const;
@@ -36,6 +51,19 @@ public:
     void setAccessToken(const std::string&);
     std::string getAccessToken() const;
 
+    /*
+     * Responses read from the ambient cache are kept in memory, up to this many bytes, so
+     * that requesting them again doesn't query the database. The least recently used ones
+     * are dropped first. Setting 0 disables the in-memory cache.
+     */
+    void setResponseCacheBytes(std::size_t);
+
+    /*
+     * Returns the hits and misses of the in-memory cache since the file source was created,
+     * along with what it currently holds.
+     */
+    ResponseCacheStats getResponseCacheStats() const;
+
     std::unique_ptr<AsyncRequest> request(const Resource&, Callback) override;
 
     /*
@@ -122,6 +150,7 @@ private:
     const std::unique_ptr<util::Thread<Impl>> thread;
     const std::unique_ptr<FileSource> assetFileSource;
     const std::unique_ptr<FileSource> localFileSource;
+    const std::unique_ptr<FileSource> mbtilesFileSource;
 };
 
 } // namespace mbgl
@@ -4,6 +4,7 @@
 #include <mbgl/storage/resource.hpp>
 
 #include <mbgl/util/noncopyable.hpp>
+#include <mbgl/util/memory_usage.hpp>
 #include <mbgl/util/async_request.hpp>
 
 #include <functional>
@@ -31,6 +32,9 @@ public:
     virtual bool supportsOptionalRequests() const {
         return false;
     }
+
+    // Frees memory that the file source can do without, such as caches.
+    virtual void onMemoryPressure(MemoryPressure) {}
 };
 
 } // namespace mbgl
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <mbgl/util/byte_buffer.hpp>
 #include <mbgl/util/chrono.hpp>
 #include <mbgl/util/optional.hpp>
 #include <mbgl/util/variant.hpp>
@@ -28,7 +29,8 @@ public:
     bool notModified = false;
 
     // The actual data of the response. Present only for non-error, non-notModified responses.
-    std::shared_ptr<const std::string> data;
+    // File sources may still assign a `std::shared_ptr<std::string>`, which is shared, not copied.
+    ByteBuffer data;
 
     optional<Timestamp> modified;
     optional<Timestamp> expires;
@@ -8,6 +8,66 @@
 namespace mbgl {
 namespace style {
 
+namespace detail {
+
+// Compares property values the way filters do: numbers of any type by their value, and values
+// of different types never match.
+template <class Op>
+struct Comparator {
+    const Op& op;
+
+    template <class T>
+    bool operator()(const T& lhs, const T& rhs) const {
+        return op(lhs, rhs);
+    }
+
+    template <class T0, class T1>
+    auto operator()(const T0& lhs, const T1& rhs) const
+        -> typename std::enable_if_t<std::is_arithmetic<T0>::value && !std::is_same<T0, bool>::value &&
+                                     std::is_arithmetic<T1>::value && !std::is_same<T1, bool>::value, bool> {
+        return op(double(lhs), double(rhs));
+    }
+
+    template <class T0, class T1>
+    auto operator()(const T0&, const T1&) const
+        -> typename std::enable_if_t<!std::is_arithmetic<T0>::value || std::is_same<T0, bool>::value ||
+                                     !std::is_arithmetic<T1>::value || std::is_same<T1, bool>::value, bool> {
+        return false;
+    }
+
+    bool operator()(const NullValue&,
+                    const NullValue&) const {
+        // Should be unreachable; null is not currently allowed by the style specification.
+        assert(false);
+        return false;
+    }
+
+    bool operator()(const std::vector<Value>&,
+                    const std::vector<Value>&) const {
+        // Should be unreachable; nested values are not currently allowed by the style specification.
+        assert(false);
+        return false;
+    }
+
+    bool operator()(const std::unordered_map<std::string, Value>&,
+                    const std::unordered_map<std::string, Value>&) const {
+        // Should be unreachable; nested values are not currently allowed by the style specification.
+        assert(false);
+        return false;
+    }
+};
+
+template <class Op>
+bool compare(const Value& lhs, const Value& rhs, const Op& op) {
+    return Value::binary_visit(lhs, rhs, Comparator<Op> { op });
+}
+
+inline bool equal(const Value& lhs, const Value& rhs) {
+    return compare(lhs, rhs, [] (const auto& lhs_, const auto& rhs_) { return lhs_ == rhs_; });
+}
+
+} // namespace detail
+
 /*
    A visitor that evaluates a `Filter` for a given feature.
 
@@ -32,32 +92,32 @@ public:
 
     bool operator()(const EqualsFilter& filter) const {
         optional<Value> actual = getValue(filter.key);
-        return actual && equal(*actual, filter.value);
+        return actual && detail::equal(*actual, filter.value);
     }
 
     bool operator()(const NotEqualsFilter& filter) const {
         optional<Value> actual = getValue(filter.key);
-        return !actual || !equal(*actual, filter.value);
+        return !actual || !detail::equal(*actual, filter.value);
     }
 
     bool operator()(const LessThanFilter& filter) const {
         optional<Value> actual = getValue(filter.key);
-        return actual && compare(*actual, filter.value, [] (const auto& lhs_, const auto& rhs_) { return lhs_ < rhs_; });
+        return actual && detail::compare(*actual, filter.value, [] (const auto& lhs_, const auto& rhs_) { return lhs_ < rhs_; });
     }
 
     bool operator()(const LessThanEqualsFilter& filter) const {
         optional<Value> actual = getValue(filter.key);
-        return actual && compare(*actual, filter.value, [] (const auto& lhs_, const auto& rhs_) { return lhs_ <= rhs_; });
+        return actual && detail::compare(*actual, filter.value, [] (const auto& lhs_, const auto& rhs_) { return lhs_ <= rhs_; });
     }
 
     bool operator()(const GreaterThanFilter& filter) const {
         optional<Value> actual = getValue(filter.key);
-        return actual && compare(*actual, filter.value, [] (const auto& lhs_, const auto& rhs_) { return lhs_ > rhs_; });
+        return actual && detail::compare(*actual, filter.value, [] (const auto& lhs_, const auto& rhs_) { return lhs_ > rhs_; });
     }
 
     bool operator()(const GreaterThanEqualsFilter& filter) const {
         optional<Value> actual = getValue(filter.key);
-        return actual && compare(*actual, filter.value, [] (const auto& lhs_, const auto& rhs_) { return lhs_ >= rhs_; });
+        return actual && detail::compare(*actual, filter.value, [] (const auto& lhs_, const auto& rhs_) { return lhs_ >= rhs_; });
     }
 
     bool operator()(const InFilter& filter) const {
@@ -65,7 +125,7 @@ public:
         if (!actual)
             return false;
         for (const auto& v: filter.values) {
-            if (equal(*actual, v)) {
+            if (detail::equal(*actual, v)) {
                 return true;
             }
         }
@@ -77,7 +137,7 @@ public:
         if (!actual)
             return true;
         for (const auto& v: filter.values) {
-            if (equal(*actual, v)) {
+            if (detail::equal(*actual, v)) {
                 return false;
             }
         }
@@ -135,60 +195,6 @@ private:
             return propertyAccessor(key_);
         }
     }
-
-    template <class Op>
-    struct Comparator {
-        const Op& op;
-
-        template <class T>
-        bool operator()(const T& lhs, const T& rhs) const {
-            return op(lhs, rhs);
-        }
-
-        template <class T0, class T1>
-        auto operator()(const T0& lhs, const T1& rhs) const
-            -> typename std::enable_if_t<std::is_arithmetic<T0>::value && !std::is_same<T0, bool>::value &&
-                                         std::is_arithmetic<T1>::value && !std::is_same<T1, bool>::value, bool> {
-            return op(double(lhs), double(rhs));
-        }
-
-        template <class T0, class T1>
-        auto operator()(const T0&, const T1&) const
-            -> typename std::enable_if_t<!std::is_arithmetic<T0>::value || std::is_same<T0, bool>::value ||
-                                         !std::is_arithmetic<T1>::value || std::is_same<T1, bool>::value, bool> {
-            return false;
-        }
-
-        bool operator()(const NullValue&,
-                        const NullValue&) const {
-            // Should be unreachable; null is not currently allowed by the style specification.
-            assert(false);
-            return false;
-        }
-
-        bool operator()(const std::vector<Value>&,
-                        const std::vector<Value>&) const {
-            // Should be unreachable; nested values are not currently allowed by the style specification.
-            assert(false);
-            return false;
-        }
-
-        bool operator()(const std::unordered_map<std::string, Value>&,
-                        const std::unordered_map<std::string, Value>&) const {
-            // Should be unreachable; nested values are not currently allowed by the style specification.
-            assert(false);
-            return false;
-        }
-    };
-
-    template <class Op>
-    bool compare(const Value& lhs, const Value& rhs, const Op& op) const {
-        return Value::binary_visit(lhs, rhs, Comparator<Op> { op });
-    }
-
-    bool equal(const Value& lhs, const Value& rhs) const {
-        return compare(lhs, rhs, [] (const auto& lhs_, const auto& rhs_) { return lhs_ == rhs_; });
-    }
 };
 
 inline bool Filter::operator()(const Feature& feature) const {
@@ -110,9 +110,9 @@ public:
 
     // Zoom range
     float getMinZoom() const;
-    void setMinZoom(float) const;
+    void setMinZoom(float);
     float getMaxZoom() const;
-    void setMaxZoom(float) const;
+    void setMaxZoom(float);
 
     // Private implementation
     const std::unique_ptr<Impl> baseImpl;
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace mbgl {
+
+/*
+    An immutable sequence of bytes, shared by reference count.
+
+    The bytes belong to an owner that keeps them alive: a string, a memory-mapped file, or any
+    other object that holds memory. Copying a buffer, or taking a slice of it, shares the owner
+    instead of copying the bytes, so that data can travel from a file source to the parsers
+    without being copied on the way.
+
+    A default-constructed buffer is null, which is distinct from an empty one. The bytes are
+    not null-terminated.
+*/
+class ByteBuffer {
+public:
+    ByteBuffer() = default;
+    ByteBuffer(std::nullptr_t) {}
+
+    // Takes ownership of the string.
+    explicit ByteBuffer(std::string);
+
+    // Shares a string that is already reference counted. A null pointer gives a null buffer.
+    ByteBuffer(std::shared_ptr<const std::string>);
+    ByteBuffer(std::shared_ptr<std::string>);
+
+    // Refers to `size` bytes at `data`, which must stay valid until `owner` is destroyed.
+    ByteBuffer(std::shared_ptr<const void> owner, const char* data, std::size_t size);
+
+    const char* data() const { return bytes; }
+    std::size_t size() const { return length; }
+    bool empty() const { return length == 0; }
+
+    const char* begin() const { return bytes; }
+    const char* end() const { return bytes + length; }
+
+    // Returns `length` bytes starting at `offset`, sharing this buffer's owner. Throws
+    // `std::out_of_range` if they don't all lie within this buffer.
+    ByteBuffer slice(std::size_t offset, std::size_t length) const;
+
+    // Copies the bytes into a string.
+    std::string string() const;
+
+    explicit operator bool() const { return bool(owner); }
+
+private:
+    std::shared_ptr<const void> owner;
+    const char* bytes = nullptr;
+    std::size_t length = 0;
+};
+
+// Two buffers are equal if both are null, or if neither is and they hold the same bytes.
+bool operator==(const ByteBuffer&, const ByteBuffer&);
+
+inline bool operator!=(const ByteBuffer& lhs, const ByteBuffer& rhs) {
+    return !(lhs == rhs);
+}
+
+} // namespace mbgl
@@ -1,12 +1,21 @@
 #pragma once
 
+#include <cstddef>
 #include <string>
 
 namespace mbgl {
 namespace util {
         
 std::string compress(const std::string& raw);
+std::string compress(const char* raw, std::size_t size);
+
+// Inflates zlib or gzip compressed data.
 std::string decompress(const std::string& raw);
+std::string decompress(const char* raw, std::size_t size);
+
+// Whether the data starts with a zlib or gzip header.
+bool isCompressed(const std::string& data);
+bool isCompressed(const char* data, std::size_t size);
     
 } // namespace util
 } // namespace mbgl
@@ -4,6 +4,7 @@
 #include <mbgl/util/unitbezier.hpp>
 
 #include <cmath>
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -40,6 +41,21 @@ constexpr float  MAX_ZOOM_F = MAX_ZOOM;
 
 constexpr uint64_t DEFAULT_MAX_CACHE_SIZE = 50 * 1024 * 1024;
 
+// The memory that the default file source spends on keeping responses that it read from the
+// ambient cache, so that reading them again doesn't go to the database.
+constexpr std::size_t DEFAULT_RESPONSE_CACHE_BYTES = 16 * 1024 * 1024;
+
+// The memory that all sources together may spend on tiles that are no longer displayed but kept
+// around in case they are needed again.
+constexpr std::size_t DEFAULT_TILE_CACHE_BYTES = 64 * 1024 * 1024;
+
+// The GPU memory that a map may use before cached tiles release their GPU buffers and textures.
+constexpr std::size_t DEFAULT_GPU_MEMORY_BUDGET = 128 * 1024 * 1024;
+
+// Tiles whose layout has to process at least this many features have their buckets built
+// in parallel.
+constexpr std::size_t DEFAULT_PARALLEL_LAYOUT_THRESHOLD = 4096;
+
 constexpr Duration DEFAULT_FADE_DURATION = Milliseconds(300);
 constexpr Seconds CLOCK_SKEW_RETRY_TIMEOUT { 30 };
 
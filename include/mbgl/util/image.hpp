@@ -3,6 +3,7 @@
 #include <mbgl/util/noncopyable.hpp>
 #include <mbgl/util/size.hpp>
 
+#include <cstddef>
 #include <string>
 #include <memory>
 #include <algorithm>
@@ -60,8 +61,12 @@ using UnassociatedImage = Image<ImageAlphaMode::Unassociated>;
 using PremultipliedImage = Image<ImageAlphaMode::Premultiplied>;
 using AlphaImage = Image<ImageAlphaMode::Exclusive>;
 
-// TODO: don't use std::string for binary data.
-PremultipliedImage decodeImage(const std::string&);
+PremultipliedImage decodeImage(const char* data, std::size_t size);
+
+inline PremultipliedImage decodeImage(const std::string& data) {
+    return decodeImage(data.data(), data.size());
+}
+
 std::string encodePNG(const PremultipliedImage&);
 
 } // namespace mbgl
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstddef>
+
+namespace mbgl {
+
+// The layouts and placements of tiles that the workers of a map ran.
+class LayoutStatistics {
+public:
+    // Those that ran to completion.
+    std::size_t completed = 0;
+
+    // Those that were abandoned midway because their tile became obsolete.
+    std::size_t abandoned = 0;
+};
+
+} // namespace mbgl
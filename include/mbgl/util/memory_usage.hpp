@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace mbgl {
+
+// Bytes held in main memory, and in GPU buffers and textures.
+class MemoryUsage {
+public:
+    std::size_t cpu = 0;
+    std::size_t gpu = 0;
+
+    std::size_t total() const {
+        return cpu + gpu;
+    }
+
+    MemoryUsage& operator+=(const MemoryUsage& other) {
+        cpu += other.cpu;
+        gpu += other.gpu;
+        return *this;
+    }
+
+    MemoryUsage& operator-=(const MemoryUsage& other) {
+        cpu -= other.cpu;
+        gpu -= other.gpu;
+        return *this;
+    }
+
+    // The share of each of `owners` that hold on to the memory together.
+    MemoryUsage operator/(std::size_t owners) const {
+        return { cpu / owners, gpu / owners };
+    }
+};
+
+// The memory taken up by the tiles of a source.
+class SourceMemoryUsage {
+public:
+    // Tiles that are displayed or loading.
+    MemoryUsage tiles;
+
+    // Tiles that are kept in the tile cache.
+    MemoryUsage cache;
+};
+
+// How much memory to free when the system runs low on it. Each level frees everything that
+// the previous one does, and more.
+enum class MemoryPressure : uint8_t {
+    // The least recently used cached tiles are dropped until the cache takes up half as many
+    // bytes as before. The others only keep what they need to be displayed again, in main
+    // memory, along with the buckets they share with displayed tiles.
+    Moderate,
+
+    // Cached tiles are dropped, and tiles that aren't displayed only stay in main memory.
+    // File sources release their database caches.
+    Critical,
+
+    // Nothing is displayed for the time being: GPU resources are released altogether.
+    Background,
+};
+
+} // namespace mbgl
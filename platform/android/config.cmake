@@ -63,6 +63,7 @@ macro(mbgl_platform_core)
         PRIVATE platform/android/src/http_file_source.cpp
         PRIVATE platform/default/default_file_source.cpp
         PRIVATE platform/default/local_file_source.cpp
+        PRIVATE platform/default/mbtiles_file_source.cpp
         PRIVATE platform/default/online_file_source.cpp
 
         # Offline
@@ -72,6 +73,8 @@ macro(mbgl_platform_core)
         PRIVATE platform/default/mbgl/storage/offline_database.hpp
         PRIVATE platform/default/mbgl/storage/offline_download.cpp
         PRIVATE platform/default/mbgl/storage/offline_download.hpp
+        PRIVATE platform/default/mbgl/storage/response_cache.cpp
+        PRIVATE platform/default/mbgl/storage/response_cache.hpp
         PRIVATE platform/default/sqlite3.cpp
         PRIVATE platform/default/sqlite3.hpp
 
@@ -88,6 +91,10 @@ macro(mbgl_platform_core)
         # Thread pool
         PRIVATE platform/default/mbgl/util/default_thread_pool.cpp
         PRIVATE platform/default/mbgl/util/default_thread_pool.hpp
+        PRIVATE platform/default/mbgl/util/work_stealing_thread_pool.cpp
+        PRIVATE platform/default/mbgl/util/work_stealing_thread_pool.hpp
+        PRIVATE platform/default/mbgl/util/elastic_thread_pool.cpp
+        PRIVATE platform/default/mbgl/util/elastic_thread_pool.hpp
 
         # Conversion C++ -> Java
         platform/android/src/conversion/constant.hpp
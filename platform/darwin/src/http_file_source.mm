@@ -286,7 +286,13 @@ std::unique_ptr<AsyncRequest> HTTPFileSource::request(const Resource& resource,
                     }
 
                     if (responseCode == 200) {
-                        response.data = std::make_shared<std::string>((const char *)[data bytes], [data length]);
+                        if ([data length]) {
+                            // Share the bytes of the NSData instead of copying them.
+                            response.data = ByteBuffer(std::shared_ptr<const void>(CFBridgingRetain(data), CFRelease),
+                                                       (const char *)[data bytes], [data length]);
+                        } else {
+                            response.data = ByteBuffer(std::string());
+                        }
                     } else if (responseCode == 204 || (responseCode == 404 && resource.kind == Resource::Kind::Tile)) {
                         response.noContent = true;
                     } else if (responseCode == 304) {
@@ -66,8 +66,8 @@ std::string encodePNG(const PremultipliedImage& src) {
     return result;
 }
 
-PremultipliedImage decodeImage(const std::string &source_data) {
-    CFDataRef data = CFDataCreateWithBytesNoCopy(kCFAllocatorDefault, reinterpret_cast<const unsigned char *>(source_data.data()), source_data.size(), kCFAllocatorNull);
+PremultipliedImage decodeImage(const char *source_data, std::size_t size) {
+    CFDataRef data = CFDataCreateWithBytesNoCopy(kCFAllocatorDefault, reinterpret_cast<const unsigned char *>(source_data), size, kCFAllocatorNull);
     if (!data) {
         throw std::runtime_error("CFDataCreateWithBytesNoCopy failed");
     }
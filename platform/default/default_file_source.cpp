@@ -1,9 +1,11 @@
 #include <mbgl/storage/default_file_source.hpp>
 #include <mbgl/storage/asset_file_source.hpp>
 #include <mbgl/storage/local_file_source.hpp>
+#include <mbgl/storage/mbtiles_file_source.hpp>
 #include <mbgl/storage/online_file_source.hpp>
 #include <mbgl/storage/offline_database.hpp>
 #include <mbgl/storage/offline_download.hpp>
+#include <mbgl/storage/response_cache.hpp>
 
 #include <mbgl/util/platform.hpp>
 #include <mbgl/util/url.hpp>
@@ -86,6 +88,8 @@ public:
         try {
             downloads.erase(region.getID());
             offlineDatabase.deleteRegion(std::move(region));
+            // Deleting a region evicts resources that no other region uses, which can be any.
+            responseCache.clear();
             callback({});
         } catch (...) {
             callback(std::current_exception());
@@ -105,7 +109,13 @@ public:
 
         const bool hasPrior = resource.priorEtag || resource.priorModified || resource.priorExpires;
         if (!hasPrior || resource.necessity == Resource::Optional) {
-            auto offlineResponse = offlineDatabase.get(resource);
+            auto offlineResponse = responseCache.get(resource);
+            if (!offlineResponse) {
+                offlineResponse = offlineDatabase.get(resource);
+                if (offlineResponse) {
+                    responseCache.put(resource, *offlineResponse);
+                }
+            }
 
             if (resource.necessity == Resource::Optional && !offlineResponse) {
                 // Ensure there's always a response that we can send, so the caller knows that
@@ -127,6 +137,7 @@ public:
         if (resource.necessity == Resource::Required) {
             tasks[req] = onlineFileSource.request(revalidation, [=] (Response onlineResponse) {
                 this->offlineDatabase.put(revalidation, onlineResponse);
+                this->responseCache.remove(revalidation);
                 callback(onlineResponse);
             });
         }
@@ -142,6 +153,24 @@ public:
 
     void put(const Resource& resource, const Response& response) {
         offlineDatabase.put(resource, response);
+        responseCache.remove(resource);
+    }
+
+    void setResponseCacheBytes(std::size_t bytes) {
+        responseCache.setMaxBytes(bytes);
+    }
+
+    ResponseCacheStats getResponseCacheStats() const {
+        return responseCache.getStats();
+    }
+
+    void clearResponseCache() {
+        responseCache.clear();
+    }
+
+    void shrinkMemory() {
+        responseCache.clear();
+        offlineDatabase.shrinkMemory();
     }
 
 private:
@@ -151,10 +180,13 @@ private:
             return *it->second;
         }
         return *downloads.emplace(regionID,
-            std::make_unique<OfflineDownload>(regionID, offlineDatabase.getRegionDefinition(regionID), offlineDatabase, onlineFileSource)).first->second;
+            std::make_unique<OfflineDownload>(regionID, offlineDatabase.getRegionDefinition(regionID), offlineDatabase, responseCache, onlineFileSource)).first->second;
     }
 
     OfflineDatabase offlineDatabase;
+    // Hits skip the database altogether, so they don't refresh the time at which the resource
+    // was last accessed there; the ambient cache evicts by the last time it was read from disk.
+    ResponseCache responseCache;
     OnlineFileSource onlineFileSource;
     std::unordered_map<AsyncRequest*, std::unique_ptr<AsyncRequest>> tasks;
     std::unordered_map<int64_t, std::unique_ptr<OfflineDownload>> downloads;
@@ -166,7 +198,8 @@ DefaultFileSource::DefaultFileSource(const std::string& cachePath,
     : thread(std::make_unique<util::Thread<Impl>>(util::ThreadContext{"DefaultFileSource", util::ThreadPriority::Low},
             cachePath, maximumCacheSize)),
       assetFileSource(std::make_unique<AssetFileSource>(assetRoot)),
-      localFileSource(std::make_unique<LocalFileSource>()) {
+      localFileSource(std::make_unique<LocalFileSource>()),
+      mbtilesFileSource(std::make_unique<MBTilesFileSource>()) {
 }
 
 DefaultFileSource::~DefaultFileSource() = default;
@@ -187,6 +220,14 @@ std::string DefaultFileSource::getAccessToken() const {
     return thread->invokeSync(&Impl::getAccessToken);
 }
 
+void DefaultFileSource::setResponseCacheBytes(std::size_t bytes) {
+    thread->invokeSync(&Impl::setResponseCacheBytes, bytes);
+}
+
+ResponseCacheStats DefaultFileSource::getResponseCacheStats() const {
+    return thread->invokeSync(&Impl::getResponseCacheStats);
+}
+
 std::unique_ptr<AsyncRequest> DefaultFileSource::request(const Resource& resource, Callback callback) {
     class DefaultFileRequest : public AsyncRequest {
     public:
@@ -207,11 +248,22 @@ std::unique_ptr<AsyncRequest> DefaultFileSource::request(const Resource& resourc
         return assetFileSource->request(resource, callback);
     } else if (LocalFileSource::acceptsURL(resource.url)) {
         return localFileSource->request(resource, callback);
+    } else if (MBTilesFileSource::acceptsURL(resource.url)) {
+        return mbtilesFileSource->request(resource, callback);
     } else {
         return std::make_unique<DefaultFileRequest>(resource, callback, *thread);
     }
 }
 
+void DefaultFileSource::onMemoryPressure(MemoryPressure pressure) {
+    mbtilesFileSource->onMemoryPressure(pressure);
+    if (pressure == MemoryPressure::Moderate) {
+        thread->invoke(&Impl::clearResponseCache);
+    } else {
+        thread->invoke(&Impl::shrinkMemory);
+    }
+}
+
 void DefaultFileSource::listOfflineRegions(std::function<void (std::exception_ptr, optional<std::vector<OfflineRegion>>)> callback) {
     thread->invoke(&Impl::listRegions, callback);
 }
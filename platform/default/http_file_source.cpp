@@ -13,6 +13,7 @@
 
 #include <curl/curl.h>
 
+#include <algorithm>
 #include <queue>
 #include <map>
 #include <cassert>
@@ -282,11 +283,35 @@ size_t HTTPRequest::writeCallback(void *const contents, const size_t size, const
     assert(userp);
     auto impl = reinterpret_cast<HTTPRequest *>(userp);
 
-    if (!impl->data) {
-        impl->data = std::make_shared<std::string>();
-    }
+    // The announced Content-Length comes from the server, so no more than this is reserved up
+    // front. Larger bodies grow the buffer as they arrive.
+    const std::size_t maxReservedLength = 16 * 1024 * 1024;
+
+    // Exceptions must not unwind through curl. Returning less than was passed in makes curl
+    // abort the transfer with CURLE_WRITE_ERROR.
+    try {
+        if (!impl->data) {
+            impl->data = std::make_shared<std::string>();
+
+            // Size the buffer for the whole body when the server announces it, so that appending
+            // doesn't reallocate and copy what has been received so far.
+#if LIBCURL_VERSION_NUM >= ((7) << 16 | (55) << 8 | 0) // Added in 7.55.0
+            curl_off_t length = -1;
+            if (curl_easy_getinfo(impl->handle, CURLINFO_CONTENT_LENGTH_DOWNLOAD_T, &length) == CURLE_OK && length > 0) {
+                impl->data->reserve(static_cast<std::size_t>(std::min<curl_off_t>(length, maxReservedLength)));
+            }
+#else
+            double length = -1;
+            if (curl_easy_getinfo(impl->handle, CURLINFO_CONTENT_LENGTH_DOWNLOAD, &length) == CURLE_OK && length > 0) {
+                impl->data->reserve(static_cast<std::size_t>(std::min<double>(length, maxReservedLength)));
+            }
+#endif
+        }
 
-    impl->data->append((char *)contents, size * nmemb);
+        impl->data->append((char *)contents, size * nmemb);
+    } catch (...) {
+        return 0;
+    }
     return size * nmemb;
 }
 
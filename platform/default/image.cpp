@@ -81,9 +81,8 @@ PremultipliedImage decodeWebP(const uint8_t*, size_t);
 PremultipliedImage decodePNG(const uint8_t*, size_t);
 PremultipliedImage decodeJPEG(const uint8_t*, size_t);
 
-PremultipliedImage decodeImage(const std::string& string) {
-    const uint8_t* data = reinterpret_cast<const uint8_t*>(string.data());
-    const size_t size = string.size();
+PremultipliedImage decodeImage(const char* bytes, std::size_t size) {
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(bytes);
 
 #if !defined(__ANDROID__) && !defined(__APPLE__)
     if (size >= 12) {
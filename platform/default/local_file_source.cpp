@@ -36,7 +36,7 @@ public:
             response.error = std::make_unique<Response::Error>(Response::Error::Reason::NotFound);
         } else {
             try {
-                response.data = std::make_shared<std::string>(util::read_file(path));
+                response.data = util::map_file(path);
             } catch (...) {
                 response.error = std::make_unique<Response::Error>(
                     Response::Error::Reason::Other,
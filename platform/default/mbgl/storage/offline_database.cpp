@@ -169,14 +169,17 @@ std::pair<bool, uint64_t> OfflineDatabase::putInternal(const Resource& resource,
         return { false, 0 };
     }
 
-    std::string compressedData;
+    ByteBuffer data = response.data;
     bool compressed = false;
     uint64_t size = 0;
 
     if (response.data) {
-        compressedData = util::compress(*response.data);
-        compressed = compressedData.size() < response.data->size();
-        size = compressed ? compressedData.size() : response.data->size();
+        std::string compressedData = util::compress(response.data.data(), response.data.size());
+        compressed = compressedData.size() < response.data.size();
+        if (compressed) {
+            data = ByteBuffer(std::move(compressedData));
+        }
+        size = data.size();
     }
 
     if (evict_ && !evict(size)) {
@@ -188,13 +191,9 @@ std::pair<bool, uint64_t> OfflineDatabase::putInternal(const Resource& resource,
 
     if (resource.kind == Resource::Kind::Tile) {
         assert(resource.tileData);
-        inserted = putTile(*resource.tileData, response,
-                compressed ? compressedData : *response.data,
-                compressed);
+        inserted = putTile(*resource.tileData, response, data, compressed);
     } else {
-        inserted = putResource(resource, response,
-                compressed ? compressedData : *response.data,
-                compressed);
+        inserted = putResource(resource, response, data, compressed);
     }
 
     return { inserted, size };
@@ -238,8 +237,8 @@ optional<std::pair<Response, uint64_t>> OfflineDatabase::getResource(const Resou
         response.data = std::make_shared<std::string>(util::decompress(*data));
         size = data->length();
     } else {
-        response.data = std::make_shared<std::string>(*data);
         size = data->length();
+        response.data = std::make_shared<std::string>(std::move(*data));
     }
 
     return std::make_pair(response, size);
@@ -260,7 +259,7 @@ optional<int64_t> OfflineDatabase::hasResource(const Resource& resource) {
 
 bool OfflineDatabase::putResource(const Resource& resource,
                                   const Response& response,
-                                  const std::string& data,
+                                  const ByteBuffer& data,
                                   bool compressed) {
     if (response.notModified) {
         // clang-format off
@@ -401,8 +400,8 @@ optional<std::pair<Response, uint64_t>> OfflineDatabase::getTile(const Resource:
         response.data = std::make_shared<std::string>(util::decompress(*data));
         size = data->length();
     } else {
-        response.data = std::make_shared<std::string>(*data);
         size = data->length();
+        response.data = std::make_shared<std::string>(std::move(*data));
     }
 
     return std::make_pair(response, size);
@@ -435,7 +434,7 @@ optional<int64_t> OfflineDatabase::hasTile(const Resource::TileData& tile) {
 
 bool OfflineDatabase::putTile(const Resource::TileData& tile,
                               const Response& response,
-                              const std::string& data,
+                              const ByteBuffer& data,
                               bool compressed) {
     if (response.notModified) {
         // clang-format off
@@ -869,4 +868,9 @@ uint64_t OfflineDatabase::getOfflineMapboxTileCount() {
     return *offlineMapboxTileCount;
 }
 
+void OfflineDatabase::shrinkMemory() {
+    statements.clear();
+    db->exec("PRAGMA shrink_memory");
+}
+
 } // namespace mbgl
@@ -2,6 +2,7 @@
 
 #include <mbgl/storage/resource.hpp>
 #include <mbgl/storage/offline.hpp>
+#include <mbgl/util/byte_buffer.hpp>
 #include <mbgl/util/noncopyable.hpp>
 #include <mbgl/util/optional.hpp>
 #include <mbgl/util/constants.hpp>
@@ -57,6 +58,10 @@ public:
     bool offlineMapboxTileCountLimitExceeded();
     uint64_t getOfflineMapboxTileCount();
 
+    // Frees the prepared statements and as much of SQLite's page cache as possible. Both are
+    // rebuilt as the database is used.
+    void shrinkMemory();
+
 private:
     void connect(int flags);
     int userVersion();
@@ -83,12 +88,12 @@ private:
     optional<std::pair<Response, uint64_t>> getTile(const Resource::TileData&);
     optional<int64_t> hasTile(const Resource::TileData&);
     bool putTile(const Resource::TileData&, const Response&,
-                 const std::string&, bool compressed);
+                 const ByteBuffer&, bool compressed);
 
     optional<std::pair<Response, uint64_t>> getResource(const Resource&);
     optional<int64_t> hasResource(const Resource&);
     bool putResource(const Resource&, const Response&,
-                     const std::string&, bool compressed);
+                     const ByteBuffer&, bool compressed);
 
     optional<std::pair<Response, uint64_t>> getInternal(const Resource&);
     optional<int64_t> hasInternal(const Resource&);
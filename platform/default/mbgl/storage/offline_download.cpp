@@ -1,6 +1,7 @@
 #include <mbgl/storage/file_source.hpp>
 #include <mbgl/storage/offline_database.hpp>
 #include <mbgl/storage/offline_download.hpp>
+#include <mbgl/storage/response_cache.hpp>
 #include <mbgl/storage/resource.hpp>
 #include <mbgl/storage/response.hpp>
 #include <mbgl/storage/http_file_source.hpp>
@@ -20,10 +21,12 @@ namespace mbgl {
 OfflineDownload::OfflineDownload(int64_t id_,
                                  OfflineRegionDefinition&& definition_,
                                  OfflineDatabase& offlineDatabase_,
+                                 ResponseCache& responseCache_,
                                  FileSource& onlineFileSource_)
     : id(id_),
       definition(definition_),
       offlineDatabase(offlineDatabase_),
+      responseCache(responseCache_),
       onlineFileSource(onlineFileSource_) {
     setObserver(nullptr);
 }
@@ -64,7 +67,7 @@ OfflineRegionStatus OfflineDownload::getStatus() const {
     }
 
     style::Parser parser;
-    parser.parse(*styleResponse->data);
+    parser.parse(styleResponse->data.string());
 
     result.requiredResourceCountIsPrecise = true;
 
@@ -89,7 +92,7 @@ OfflineRegionStatus OfflineDownload::getStatus() const {
                 if (sourceResponse) {
                     result.requiredResourceCount +=
                         definition.tileCover(type, tileSize, style::TileSourceImpl::parseTileJSON(
-                            *sourceResponse->data, url, type, tileSize).zoomRange).size();
+                            sourceResponse->data.string(), url, type, tileSize).zoomRange).size();
                 } else {
                     result.requiredResourceCountIsPrecise = false;
                 }
@@ -132,7 +135,7 @@ void OfflineDownload::activateDownload() {
         status.requiredResourceCountIsPrecise = true;
 
         style::Parser parser;
-        parser.parse(*styleResponse.data);
+        parser.parse(styleResponse.data.string());
 
         for (const auto& source : parser.sources) {
             SourceType type = source->baseImpl->type;
@@ -155,7 +158,7 @@ void OfflineDownload::activateDownload() {
 
                     ensureResource(Resource::source(url), [=](Response sourceResponse) {
                         queueTiles(type, tileSize, style::TileSourceImpl::parseTileJSON(
-                            *sourceResponse.data, url, type, tileSize));
+                            sourceResponse.data.string(), url, type, tileSize));
 
                         requiredSourceURLs.erase(url);
                         if (requiredSourceURLs.empty()) {
@@ -298,6 +301,7 @@ void OfflineDownload::ensureResource(const Resource& resource,
 
             status.completedResourceCount++;
             uint64_t resourceSize = offlineDatabase.putRegionResource(id, resource, onlineResponse);
+            responseCache.remove(resource);
             status.completedResourceSize += resourceSize;
             if (resource.kind == Resource::Kind::Tile) {
                 status.completedTileCount += 1;
@@ -11,6 +11,7 @@
 namespace mbgl {
 
 class OfflineDatabase;
+class ResponseCache;
 class FileSource;
 class AsyncRequest;
 class Response;
@@ -27,7 +28,8 @@ class Parser;
  */
 class OfflineDownload {
 public:
-    OfflineDownload(int64_t id, OfflineRegionDefinition&&, OfflineDatabase& offline, FileSource& online);
+    // Resources that the download stores in `offline` are removed from `cache`.
+    OfflineDownload(int64_t id, OfflineRegionDefinition&&, OfflineDatabase& offline, ResponseCache& cache, FileSource& online);
     ~OfflineDownload();
 
     void setObserver(std::unique_ptr<OfflineRegionObserver>);
@@ -51,6 +53,7 @@ private:
     int64_t id;
     OfflineRegionDefinition definition;
     OfflineDatabase& offlineDatabase;
+    ResponseCache& responseCache;
     FileSource& onlineFileSource;
     OfflineRegionStatus status;
     std::unique_ptr<OfflineRegionObserver> observer;
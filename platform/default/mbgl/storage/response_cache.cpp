@@ -0,0 +1,78 @@
+#include <mbgl/storage/response_cache.hpp>
+
+#include <cassert>
+
+namespace mbgl {
+
+ResponseCache::ResponseCache(std::size_t maxBytes_)
+    : maxBytes(maxBytes_) {
+}
+
+void ResponseCache::setMaxBytes(std::size_t maxBytes_) {
+    maxBytes = maxBytes_;
+    evict();
+}
+
+optional<Response> ResponseCache::get(const Resource& resource) {
+    auto it = index.find(resource.url);
+    if (it == index.end()) {
+        misses++;
+        return {};
+    }
+
+    hits++;
+    entries.splice(entries.end(), entries, it->second);
+    return it->second->response;
+}
+
+void ResponseCache::put(const Resource& resource, const Response& response) {
+    remove(resource);
+
+    const std::size_t size = resource.url.size() + response.data.size();
+    if (size > maxBytes) {
+        return;
+    }
+
+    entries.push_back({ resource.url, response, size });
+    index.emplace(resource.url, std::prev(entries.end()));
+    bytes += size;
+
+    evict();
+}
+
+void ResponseCache::remove(const Resource& resource) {
+    auto it = index.find(resource.url);
+    if (it != index.end()) {
+        erase(it->second);
+    }
+}
+
+void ResponseCache::clear() {
+    entries.clear();
+    index.clear();
+    bytes = 0;
+}
+
+ResponseCacheStats ResponseCache::getStats() const {
+    ResponseCacheStats stats;
+    stats.hits = hits;
+    stats.misses = misses;
+    stats.bytes = bytes;
+    stats.entries = entries.size();
+    return stats;
+}
+
+void ResponseCache::erase(std::list<Entry>::iterator it) {
+    bytes -= it->bytes;
+    index.erase(it->url);
+    entries.erase(it);
+}
+
+void ResponseCache::evict() {
+    while (bytes > maxBytes) {
+        assert(!entries.empty());
+        erase(entries.begin());
+    }
+}
+
+} // namespace mbgl
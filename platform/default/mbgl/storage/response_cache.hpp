@@ -0,0 +1,61 @@
+#pragma once
+
+#include <mbgl/storage/default_file_source.hpp>
+#include <mbgl/storage/resource.hpp>
+#include <mbgl/storage/response.hpp>
+#include <mbgl/util/constants.hpp>
+#include <mbgl/util/noncopyable.hpp>
+#include <mbgl/util/optional.hpp>
+
+#include <cstddef>
+#include <list>
+#include <string>
+#include <unordered_map>
+
+namespace mbgl {
+
+/*
+    Keeps the responses that were most recently read from the `OfflineDatabase` in memory, by
+    URL, so that reading them again skips the query and decompression. Responses are evicted
+    least recently used first to stay within a byte budget, which counts the size of their
+    data and URL.
+
+    The cache doesn't know when the database changes: whoever writes a resource to the
+    database must `remove` it here.
+*/
+class ResponseCache : private util::noncopyable {
+public:
+    explicit ResponseCache(std::size_t maxBytes = util::DEFAULT_RESPONSE_CACHE_BYTES);
+
+    void setMaxBytes(std::size_t);
+
+    // Counts as a hit or a miss, and makes a hit the most recently used response.
+    optional<Response> get(const Resource&);
+
+    void put(const Resource&, const Response&);
+    void remove(const Resource&);
+    void clear();
+
+    ResponseCacheStats getStats() const;
+
+private:
+    struct Entry {
+        std::string url;
+        Response response;
+        std::size_t bytes;
+    };
+
+    void erase(std::list<Entry>::iterator);
+    void evict();
+
+    // Least recently used first.
+    std::list<Entry> entries;
+    std::unordered_map<std::string, std::list<Entry>::iterator> index;
+
+    std::size_t maxBytes;
+    std::size_t bytes = 0;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+};
+
+} // namespace mbgl
@@ -1,28 +1,46 @@
 #include <mbgl/util/default_thread_pool.hpp>
-#include <mbgl/actor/mailbox.hpp>
+
+#include <algorithm>
 
 namespace mbgl {
 
-ThreadPool::ThreadPool(std::size_t count) {
+ThreadPool::ThreadPool(std::size_t count)
+    : statistics(count) {
     threads.reserve(count);
     for (std::size_t i = 0; i < count; ++i) {
-        threads.emplace_back([this] () {
+        threads.emplace_back([this, i] () {
             while (true) {
                 std::unique_lock<std::mutex> lock(mutex);
 
-                cv.wait(lock, [this] {
-                    return !queue.empty() || terminate;
+                // Queues are indexed by priority; the highest non-empty one goes first.
+                auto queue = queues.rend();
+                cv.wait(lock, [this, &queue] {
+                    queue = std::find_if(queues.rbegin(), queues.rend(), [] (const auto& q) {
+                        return !q.empty();
+                    });
+                    return queue != queues.rend() || terminate;
                 });
 
                 if (terminate) {
                     return;
                 }
 
-                auto mailbox = queue.front();
-                queue.pop();
+                auto entry = std::move(queue->front());
+                queue->pop();
                 lock.unlock();
 
-                Mailbox::maybeReceive(mailbox);
+                if (!statistics.isEnabled()) {
+                    Mailbox::maybeReceive(std::move(entry.mailbox));
+                    continue;
+                }
+
+                const TimePoint start = Clock::now();
+                if (entry.scheduled != TimePoint()) {
+                    statistics.recordWaitTime(start - entry.scheduled);
+                }
+
+                Mailbox::maybeReceive(std::move(entry.mailbox));
+                statistics.recordBusyTime(i, Clock::now() - start);
             }
         });
     }
@@ -42,12 +60,31 @@ ThreadPool::~ThreadPool() {
 }
 
 void ThreadPool::schedule(std::weak_ptr<Mailbox> mailbox) {
+    auto priority = Mailbox::Priority::Normal;
+    if (auto locked = mailbox.lock()) {
+        priority = locked->getPriority();
+    }
+
+    const bool sampled = statistics.sample();
+
     {
         std::lock_guard<std::mutex> lock(mutex);
-        queue.push(mailbox);
+        if (sampled) {
+            std::size_t depth = 0;
+            for (const auto& queue : queues) {
+                depth += queue.size();
+            }
+            statistics.recordQueueDepth(depth);
+        }
+
+        queues[std::size_t(priority)].push({ std::move(mailbox), sampled ? Clock::now() : TimePoint() });
     }
 
     cv.notify_one();
 }
 
+SchedulerStatistics* ThreadPool::getStatistics() {
+    return &statistics;
+}
+
 } // namespace mbgl
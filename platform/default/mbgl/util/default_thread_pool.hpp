@@ -1,7 +1,11 @@
 #pragma once
 
 #include <mbgl/actor/scheduler.hpp>
+#include <mbgl/actor/scheduler_statistics.hpp>
+#include <mbgl/actor/mailbox.hpp>
+#include <mbgl/util/chrono.hpp>
 
+#include <array>
 #include <condition_variable>
 #include <mutex>
 #include <queue>
@@ -15,13 +19,29 @@ public:
     ~ThreadPool() override;
 
     void schedule(std::weak_ptr<Mailbox>) override;
+    std::size_t getConcurrency() const override { return threads.size(); }
+
+    // Disabled until `getStatistics()->enable()` is called.
+    SchedulerStatistics* getStatistics() override;
 
 private:
+    static constexpr std::size_t priorities = std::size_t(Mailbox::Priority::High) + 1;
+
+    class Entry {
+    public:
+        std::weak_ptr<Mailbox> mailbox;
+
+        // Only set when this entry is sampled for statistics.
+        TimePoint scheduled;
+    };
+
     std::vector<std::thread> threads;
-    std::queue<std::weak_ptr<Mailbox>> queue;
+    std::array<std::queue<Entry>, priorities> queues;
     std::mutex mutex;
     std::condition_variable cv;
     bool terminate { false };
+
+    SchedulerStatistics statistics;
 };
 
 } // namespace mbgl
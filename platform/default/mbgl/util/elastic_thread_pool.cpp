@@ -0,0 +1,158 @@
+#include <mbgl/util/elastic_thread_pool.hpp>
+
+#include <algorithm>
+
+namespace mbgl {
+
+ElasticThreadPool::ElasticThreadPool(std::size_t minThreads_, std::size_t maxThreads_, Duration idleTimeout_)
+    : minThreads(minThreads_),
+      maxThreads(std::max<std::size_t>({ maxThreads_, minThreads_, 1 })),
+      idleTimeout(idleTimeout_),
+      slots(maxThreads, false),
+      statistics(maxThreads) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (std::size_t i = 0; i < minThreads; ++i) {
+        spawn();
+    }
+}
+
+ElasticThreadPool::~ElasticThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        terminate = true;
+    }
+
+    cv.notify_all();
+
+    // Once `terminate` is set, threads no longer move themselves to `exited`.
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (auto& thread : exited) {
+        thread.join();
+    }
+}
+
+void ElasticThreadPool::schedule(std::weak_ptr<Mailbox> mailbox) {
+    auto priority = Mailbox::Priority::Normal;
+    if (auto locked = mailbox.lock()) {
+        priority = locked->getPriority();
+    }
+
+    const bool sampled = statistics.sample();
+
+    std::vector<std::thread> finished;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (sampled) {
+            statistics.recordQueueDepth(queued);
+        }
+
+        queues[std::size_t(priority)].push({ std::move(mailbox), sampled ? Clock::now() : TimePoint() });
+        ++queued;
+
+        if (queued > idle && threads.size() < maxThreads) {
+            spawn();
+        }
+
+        finished.swap(exited);
+    }
+
+    cv.notify_one();
+
+    // Threads in `exited` no longer touch the pool; joining only waits for them to unwind.
+    for (auto& thread : finished) {
+        thread.join();
+    }
+}
+
+SchedulerStatistics* ElasticThreadPool::getStatistics() {
+    return &statistics;
+}
+
+std::size_t ElasticThreadPool::getThreadCount() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return threads.size();
+}
+
+void ElasticThreadPool::spawn() {
+    const std::size_t slot = std::find(slots.begin(), slots.end(), false) - slots.begin();
+    slots[slot] = true;
+    ++idle;
+
+    // The new thread blocks on `mutex` until the iterator has been assigned.
+    auto it = threads.emplace(threads.end());
+    *it = std::thread([this, it, slot] () {
+        run(it, slot);
+    });
+}
+
+void ElasticThreadPool::run(std::list<std::thread>::iterator self, std::size_t slot) {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (true) {
+        // Queues are indexed by priority; the highest non-empty one goes first.
+        auto queue = queues.rend();
+        const bool woken = cv.wait_for(lock, idleTimeout, [this, &queue] {
+            queue = std::find_if(queues.rbegin(), queues.rend(), [] (const auto& q) {
+                return !q.empty();
+            });
+            return queue != queues.rend() || terminate;
+        });
+
+        if (terminate) {
+            break;
+        }
+
+        if (!woken) {
+            if (threads.size() > minThreads) {
+                exited.push_back(std::move(*self));
+                threads.erase(self);
+                break;
+            }
+            continue;
+        }
+
+        auto entry = std::move(queue->front());
+        queue->pop();
+        --queued;
+        --idle;
+        lock.unlock();
+
+        if (!statistics.isEnabled()) {
+            Mailbox::maybeReceive(std::move(entry.mailbox));
+        } else {
+            const TimePoint start = Clock::now();
+            if (entry.scheduled != TimePoint()) {
+                statistics.recordWaitTime(start - entry.scheduled);
+            }
+
+            Mailbox::maybeReceive(std::move(entry.mailbox));
+            statistics.recordBusyTime(slot, Clock::now() - start);
+        }
+
+        lock.lock();
+        ++idle;
+    }
+
+    --idle;
+    slots[slot] = false;
+}
+
+std::shared_ptr<ElasticThreadPool> ElasticThreadPool::shared() {
+    static std::mutex mutex;
+    static std::weak_ptr<ElasticThreadPool> weak;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto pool = weak.lock();
+    if (!pool) {
+        pool = std::make_shared<ElasticThreadPool>(
+            1, std::max<std::size_t>(4, std::thread::hardware_concurrency()));
+        weak = pool;
+    }
+    return pool;
+}
+
+} // namespace mbgl
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <mbgl/actor/scheduler.hpp>
+#include <mbgl/actor/scheduler_statistics.hpp>
+#include <mbgl/actor/mailbox.hpp>
+#include <mbgl/util/chrono.hpp>
+
+#include <array>
+#include <condition_variable>
+#include <list>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace mbgl {
+
+/*
+    An `ElasticThreadPool` provides the same guarantees as `ThreadPool`, but instead of a
+    fixed number of threads, it runs between `minThreads` and `maxThreads` of them depending
+    on load:
+
+    * When a mailbox is scheduled and there are more mailboxes waiting than idle threads,
+      one more thread is started, up to `maxThreads`.
+    * A thread that has been idle for `idleTimeout` exits, down to `minThreads`.
+
+    Growing is immediate while shrinking waits for a sustained lull, so a bursty load doesn't
+    make threads repeatedly start and exit.
+
+    `shared()` returns a process-wide instance, so that many `Map` objects can share workers
+    instead of each keeping their own idle threads around.
+*/
+
+class ElasticThreadPool : public Scheduler {
+public:
+    ElasticThreadPool(std::size_t minThreads, std::size_t maxThreads, Duration idleTimeout = Seconds(10));
+    ~ElasticThreadPool() override;
+
+    void schedule(std::weak_ptr<Mailbox>) override;
+    std::size_t getConcurrency() const override { return maxThreads; }
+
+    // Disabled until `getStatistics()->enable()` is called. Utilization is reported per
+    // thread slot, of which there are `maxThreads`.
+    SchedulerStatistics* getStatistics() override;
+
+    std::size_t getThreadCount();
+
+    // Returns the process-wide instance, creating it if necessary. It is kept alive for as
+    // long as anyone holds on to it.
+    static std::shared_ptr<ElasticThreadPool> shared();
+
+private:
+    static constexpr std::size_t priorities = std::size_t(Mailbox::Priority::High) + 1;
+
+    class Entry {
+    public:
+        std::weak_ptr<Mailbox> mailbox;
+
+        // Only set when this entry is sampled for statistics.
+        TimePoint scheduled;
+    };
+
+    // Must be called with `mutex` held.
+    void spawn();
+    void run(std::list<std::thread>::iterator, std::size_t slot);
+
+    const std::size_t minThreads;
+    const std::size_t maxThreads;
+    const Duration idleTimeout;
+
+    std::list<std::thread> threads;
+    // Threads that exited after idling, waiting to be joined.
+    std::vector<std::thread> exited;
+    // Which statistics slots are taken by running threads.
+    std::vector<bool> slots;
+    // Threads that are waiting for work or are just starting up.
+    std::size_t idle = 0;
+
+    std::array<std::queue<Entry>, priorities> queues;
+    std::size_t queued = 0;
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool terminate { false };
+
+    SchedulerStatistics statistics;
+};
+
+} // namespace mbgl
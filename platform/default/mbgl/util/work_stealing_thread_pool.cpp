@@ -0,0 +1,141 @@
+#include <mbgl/util/work_stealing_thread_pool.hpp>
+#include <mbgl/actor/mailbox.hpp>
+
+namespace mbgl {
+
+WorkStealingThreadPool::WorkStealingThreadPool(std::size_t count)
+    : statistics(count) {
+    workers.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        workers.push_back(std::make_unique<Worker>());
+    }
+
+    // Threads are only started once every deque exists, since any of them may
+    // start stealing right away.
+    for (std::size_t i = 0; i < count; ++i) {
+        workers[i]->thread = std::thread([this, i] () {
+            run(i);
+        });
+    }
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        terminate = true;
+    }
+
+    cv.notify_all();
+
+    for (auto& worker : workers) {
+        worker->thread.join();
+    }
+}
+
+void WorkStealingThreadPool::schedule(std::weak_ptr<Mailbox> mailbox) {
+    auto priority = Mailbox::Priority::Normal;
+    if (auto locked = mailbox.lock()) {
+        priority = locked->getPriority();
+    }
+
+    Worker* worker = current.get();
+    if (!worker) {
+        worker = workers[next++ % workers.size()].get();
+    }
+
+    const bool sampled = statistics.sample();
+    if (sampled) {
+        statistics.recordQueueDepth(pending);
+    }
+
+    // Both `pending` and `sleeping` are sequentially consistent: either a worker about
+    // to sleep observes the new item, or we observe the sleeper and wake it.
+    ++pending;
+
+    {
+        std::lock_guard<std::mutex> lock(worker->mutex);
+        worker->queues[std::size_t(priority)].push_back({ std::move(mailbox), sampled ? Clock::now() : TimePoint() });
+    }
+
+    if (sleeping > 0) {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        cv.notify_one();
+    }
+}
+
+void WorkStealingThreadPool::run(std::size_t index) {
+    current.set(workers[index].get());
+
+    Entry entry;
+
+    while (!terminate) {
+        if (pop(index, entry) || steal(index, entry)) {
+            --pending;
+
+            if (!statistics.isEnabled()) {
+                Mailbox::maybeReceive(std::move(entry.mailbox));
+                entry.mailbox.reset();
+                continue;
+            }
+
+            const TimePoint start = Clock::now();
+            if (entry.scheduled != TimePoint()) {
+                statistics.recordWaitTime(start - entry.scheduled);
+            }
+
+            Mailbox::maybeReceive(std::move(entry.mailbox));
+            entry.mailbox.reset();
+            statistics.recordBusyTime(index, Clock::now() - start);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        ++sleeping;
+        cv.wait(lock, [this] {
+            return pending > 0 || terminate;
+        });
+        --sleeping;
+    }
+
+    current.set(nullptr);
+}
+
+bool WorkStealingThreadPool::pop(std::size_t index, Entry& entry) {
+    Worker& worker = *workers[index];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    for (auto queue = worker.queues.rbegin(); queue != worker.queues.rend(); ++queue) {
+        if (!queue->empty()) {
+            entry = std::move(queue->front());
+            queue->pop_front();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool WorkStealingThreadPool::steal(std::size_t index, Entry& entry) {
+    for (std::size_t i = 1; i < workers.size(); ++i) {
+        Worker& victim = *workers[(index + i) % workers.size()];
+        std::unique_lock<std::mutex> lock(victim.mutex, std::try_to_lock);
+        if (!lock) {
+            continue;
+        }
+
+        for (auto queue = victim.queues.rbegin(); queue != victim.queues.rend(); ++queue) {
+            if (!queue->empty()) {
+                entry = std::move(queue->back());
+                queue->pop_back();
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+SchedulerStatistics* WorkStealingThreadPool::getStatistics() {
+    return &statistics;
+}
+
+} // namespace mbgl
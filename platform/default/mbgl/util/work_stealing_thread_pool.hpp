@@ -0,0 +1,91 @@
+#pragma once
+
+#include <mbgl/actor/scheduler.hpp>
+#include <mbgl/actor/scheduler_statistics.hpp>
+#include <mbgl/actor/mailbox.hpp>
+#include <mbgl/util/chrono.hpp>
+#include <mbgl/util/thread_local.hpp>
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace mbgl {
+
+/*
+    A `WorkStealingThreadPool` is a drop-in alternative to `ThreadPool` that avoids
+    funneling every scheduled mailbox through a single lock. Each worker thread owns
+    its own deque:
+
+    * A mailbox scheduled from one of the pool's own threads (e.g. an actor self-sending
+      a message, like `GeometryTileWorker::coalesce`) is pushed onto that thread's deque,
+      so it is likely to be picked up again by the same, cache-warm thread.
+    * A mailbox scheduled from any other thread is distributed round-robin across the
+      workers' deques.
+    * A worker pops from the front of its own deque and, when that is empty, steals from
+      the back of the other workers' deques before going to sleep.
+
+    Each worker keeps one deque per `Mailbox::Priority`. Popping and stealing both look
+    at the higher priority deques first, but a worker prefers lower priority work of its
+    own over stealing higher priority work from another worker.
+
+    The ordering and non-concurrency guarantees documented in `Scheduler` still hold,
+    since `Mailbox` never has more than one pending schedule at a time.
+*/
+
+class WorkStealingThreadPool : public Scheduler {
+public:
+    WorkStealingThreadPool(std::size_t count);
+    ~WorkStealingThreadPool() override;
+
+    void schedule(std::weak_ptr<Mailbox>) override;
+    std::size_t getConcurrency() const override { return workers.size(); }
+
+    // Disabled until `getStatistics()->enable()` is called. The queue depth is the number of
+    // mailboxes waiting in all of the workers' deques.
+    SchedulerStatistics* getStatistics() override;
+
+private:
+    static constexpr std::size_t priorities = std::size_t(Mailbox::Priority::High) + 1;
+
+    class Entry {
+    public:
+        std::weak_ptr<Mailbox> mailbox;
+
+        // Only set when this entry is sampled for statistics.
+        TimePoint scheduled;
+    };
+
+    class Worker {
+    public:
+        std::thread thread;
+        std::mutex mutex;
+        std::array<std::deque<Entry>, priorities> queues;
+    };
+
+    void run(std::size_t index);
+    bool pop(std::size_t index, Entry&);
+    bool steal(std::size_t index, Entry&);
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    util::ThreadLocal<Worker> current;
+
+    // Number of mailboxes currently sitting in any of the workers' deques.
+    std::atomic<std::size_t> pending { 0 };
+    std::atomic<std::size_t> next { 0 };
+
+    // Only used to park idle workers; scheduling doesn't take this lock unless
+    // a worker is actually asleep.
+    std::mutex sleepMutex;
+    std::condition_variable cv;
+    std::atomic<std::size_t> sleeping { 0 };
+    std::atomic<bool> terminate { false };
+
+    SchedulerStatistics statistics;
+};
+
+} // namespace mbgl
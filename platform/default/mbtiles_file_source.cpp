@@ -0,0 +1,245 @@
+#include <mbgl/storage/mbtiles_file_source.hpp>
+#include <mbgl/storage/response.hpp>
+#include <mbgl/util/optional.hpp>
+#include <mbgl/util/string.hpp>
+#include <mbgl/util/thread.hpp>
+#include <mbgl/util/url.hpp>
+
+#include "sqlite3.hpp"
+#include <sqlite3.h>
+
+#include <rapidjson/document.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include <cstdlib>
+#include <unordered_map>
+
+namespace {
+
+const char* protocol = "mbtiles://";
+const std::size_t protocolLength = 10;
+
+// Lets SQLite read the package through a memory mapping rather than copying every page it
+// touches into its own cache.
+const int64_t mmapSize = 256 * 1024 * 1024;
+
+struct TileAddress {
+    std::string path;
+    int64_t z;
+    int64_t x;
+    int64_t y;
+};
+
+mbgl::optional<int64_t> parseIndex(const std::string& str, std::size_t begin, std::size_t end) {
+    if (begin == end || end - begin > 9) {
+        return {};
+    }
+    int64_t result = 0;
+    for (std::size_t i = begin; i < end; ++i) {
+        if (str[i] < '0' || str[i] > '9') {
+            return {};
+        }
+        result = result * 10 + (str[i] - '0');
+    }
+    return result;
+}
+
+// Splits `path/{z}/{x}/{y}[.ext]` into its parts. Anything else refers to the package itself.
+mbgl::optional<TileAddress> parseTilePath(const std::string& path) {
+    int64_t indices[3];
+    std::size_t end = path.find('.', path.rfind('/') + 1);
+    if (end == std::string::npos) {
+        end = path.size();
+    }
+
+    for (int i = 2; i >= 0; --i) {
+        if (end == 0) {
+            return {};
+        }
+        const std::size_t slash = path.rfind('/', end - 1);
+        if (slash == std::string::npos) {
+            return {};
+        }
+        auto index = parseIndex(path, slash + 1, end);
+        if (!index) {
+            return {};
+        }
+        indices[i] = *index;
+        end = slash;
+    }
+
+    if (end == 0 || indices[0] > 30) {
+        return {};
+    }
+
+    return TileAddress { path.substr(0, end), indices[0], indices[1], indices[2] };
+}
+
+} // namespace
+
+namespace mbgl {
+
+class MBTilesFileSource::Impl {
+public:
+    void request(const std::string& url, FileSource::Callback callback) {
+        const std::string path = util::percentDecode(url.substr(protocolLength));
+
+        Response response;
+
+        try {
+            if (auto tile = parseTilePath(path)) {
+                getTile(*tile, response);
+            } else {
+                getTileJSON(url, path, response);
+            }
+        } catch (const mapbox::sqlite::Exception& ex) {
+            response.error = std::make_unique<Response::Error>(
+                ex.code == SQLITE_CANTOPEN ? Response::Error::Reason::NotFound
+                                           : Response::Error::Reason::Other,
+                ex.what());
+        } catch (...) {
+            response.error = std::make_unique<Response::Error>(
+                Response::Error::Reason::Other,
+                util::toString(std::current_exception()));
+        }
+
+        callback(response);
+    }
+
+    void closePackages() {
+        packages.clear();
+    }
+
+private:
+    // An open package. The statement must be finalized before the database is closed, so it
+    // is declared after it.
+    struct Package {
+        explicit Package(const std::string& path)
+            : db(open(path)),
+              tileStmt(db.prepare(
+                  "SELECT tile_data FROM tiles "
+                  "WHERE zoom_level = ?1 AND tile_column = ?2 AND tile_row = ?3")) {
+        }
+
+        static mapbox::sqlite::Database open(const std::string& path) {
+            // Only this thread uses the connection, so SQLite needn't serialize access to it.
+            mapbox::sqlite::Database database(path, mapbox::sqlite::ReadOnly | mapbox::sqlite::NoMutex);
+            database.exec("PRAGMA mmap_size = " + util::toString(mmapSize));
+            return database;
+        }
+
+        mapbox::sqlite::Database db;
+        mapbox::sqlite::Statement tileStmt;
+    };
+
+    Package& getPackage(const std::string& path) {
+        auto it = packages.find(path);
+        if (it == packages.end()) {
+            it = packages.emplace(path, std::make_unique<Package>(path)).first;
+        }
+        return *it->second;
+    }
+
+    // Resets a statement when it goes out of scope, so that it is ready for the next query and
+    // releases its read lock even if binding or stepping it threw.
+    class Query {
+    public:
+        explicit Query(mapbox::sqlite::Statement& stmt_) : stmt(stmt_) {}
+        Query(const Query&) = delete;
+        ~Query() { stmt.reset(); }
+
+        mapbox::sqlite::Statement* operator->() { return &stmt; }
+
+    private:
+        mapbox::sqlite::Statement& stmt;
+    };
+
+    void getTile(const TileAddress& tile, Response& response) {
+        Query stmt(getPackage(tile.path).tileStmt);
+
+        // MBTiles stores rows in the TMS scheme, which counts from the bottom.
+        stmt->bind(1, tile.z);
+        stmt->bind(2, tile.x);
+        stmt->bind(3, (int64_t(1) << tile.z) - 1 - tile.y);
+
+        if (stmt->run()) {
+            response.data = std::make_shared<std::string>(stmt->get<std::string>(0));
+        } else {
+            // Packages leave out empty tiles, so this is not an error.
+            response.noContent = true;
+        }
+    }
+
+    void getTileJSON(const std::string& url, const std::string& path, Response& response) {
+        Package& package = getPackage(path);
+
+        rapidjson::GenericDocument<rapidjson::UTF8<>, rapidjson::CrtAllocator> doc;
+        doc.SetObject();
+        auto& allocator = doc.GetAllocator();
+
+        doc.AddMember("tilejson", "2.1.0", allocator);
+
+        rapidjson::GenericValue<rapidjson::UTF8<>, rapidjson::CrtAllocator> tiles(rapidjson::kArrayType);
+        const std::string tileURL = url + "/{z}/{x}/{y}";
+        tiles.PushBack(rapidjson::GenericValue<rapidjson::UTF8<>, rapidjson::CrtAllocator>(
+            tileURL.c_str(), tileURL.length(), allocator), allocator);
+        doc.AddMember("tiles", tiles, allocator);
+
+        mapbox::sqlite::Statement stmt = package.db.prepare("SELECT name, value FROM metadata");
+        while (stmt.run()) {
+            const std::string name = stmt.get<std::string>(0);
+            const std::string value = stmt.get<std::string>(1);
+
+            rapidjson::GenericValue<rapidjson::UTF8<>, rapidjson::CrtAllocator> key(
+                name.c_str(), name.length(), allocator);
+
+            if (name == "minzoom" || name == "maxzoom") {
+                doc.AddMember(key, std::atof(value.c_str()), allocator);
+            } else if (name == "bounds" || name == "center") {
+                rapidjson::GenericValue<rapidjson::UTF8<>, rapidjson::CrtAllocator> numbers(rapidjson::kArrayType);
+                const char* begin = value.c_str();
+                char* end = nullptr;
+                for (double number = std::strtod(begin, &end); end != begin; number = std::strtod(begin, &end)) {
+                    numbers.PushBack(number, allocator);
+                    begin = *end == ',' ? end + 1 : end;
+                }
+                doc.AddMember(key, numbers, allocator);
+            } else if (name == "name" || name == "description" || name == "attribution" ||
+                       name == "version" || name == "format") {
+                doc.AddMember(key, rapidjson::GenericValue<rapidjson::UTF8<>, rapidjson::CrtAllocator>(
+                    value.c_str(), value.length(), allocator), allocator);
+            }
+        }
+
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+        doc.Accept(writer);
+
+        response.data = std::make_shared<std::string>(buffer.GetString(), buffer.GetSize());
+    }
+
+    std::unordered_map<std::string, std::unique_ptr<Package>> packages;
+};
+
+MBTilesFileSource::MBTilesFileSource()
+    : thread(std::make_unique<util::Thread<Impl>>(util::ThreadContext{"MBTilesFileSource", util::ThreadPriority::Low})) {
+}
+
+MBTilesFileSource::~MBTilesFileSource() = default;
+
+std::unique_ptr<AsyncRequest> MBTilesFileSource::request(const Resource& resource, Callback callback) {
+    return thread->invokeWithCallback(&Impl::request, resource.url, callback);
+}
+
+void MBTilesFileSource::onMemoryPressure(MemoryPressure pressure) {
+    if (pressure != MemoryPressure::Moderate) {
+        thread->invoke(&Impl::closePackages);
+    }
+}
+
+bool MBTilesFileSource::acceptsURL(const std::string& url) {
+    return url.compare(0, protocolLength, protocol) == 0;
+}
+
+} // namespace mbgl
@@ -17,6 +17,7 @@ macro(mbgl_platform_core)
         PRIVATE platform/default/asset_file_source.cpp
         PRIVATE platform/default/default_file_source.cpp
         PRIVATE platform/default/local_file_source.cpp
+        PRIVATE platform/default/mbtiles_file_source.cpp
         PRIVATE platform/default/online_file_source.cpp
 
         # Default styles
@@ -29,6 +30,8 @@ macro(mbgl_platform_core)
         PRIVATE platform/default/mbgl/storage/offline_database.hpp
         PRIVATE platform/default/mbgl/storage/offline_download.cpp
         PRIVATE platform/default/mbgl/storage/offline_download.hpp
+        PRIVATE platform/default/mbgl/storage/response_cache.cpp
+        PRIVATE platform/default/mbgl/storage/response_cache.hpp
         PRIVATE platform/default/sqlite3.cpp
         PRIVATE platform/default/sqlite3.hpp
 
@@ -55,6 +58,10 @@ macro(mbgl_platform_core)
         # Thread pool
         PRIVATE platform/default/mbgl/util/default_thread_pool.cpp
         PRIVATE platform/default/mbgl/util/default_thread_pool.cpp
+        PRIVATE platform/default/mbgl/util/work_stealing_thread_pool.cpp
+        PRIVATE platform/default/mbgl/util/work_stealing_thread_pool.hpp
+        PRIVATE platform/default/mbgl/util/elastic_thread_pool.cpp
+        PRIVATE platform/default/mbgl/util/elastic_thread_pool.hpp
     )
 
     target_add_mason_package(mbgl-core PUBLIC geojson)
@@ -99,10 +99,12 @@ void NodeRequest::HandleCallback(const Nan::FunctionCallbackInfo<v8::Value>& inf
         if (Nan::Has(res, Nan::New("data").ToLocalChecked()).FromJust()) {
             auto data = Nan::Get(res, Nan::New("data").ToLocalChecked()).ToLocalChecked();
             if (node::Buffer::HasInstance(data)) {
-                response.data = std::make_shared<std::string>(
+                // The bytes live in the JS heap, which the threads that end up releasing the
+                // response must not touch, so they are copied rather than shared.
+                response.data = mbgl::ByteBuffer(std::string(
                     node::Buffer::Data(data),
                     node::Buffer::Length(data)
-                );
+                ));
             } else {
                 return Nan::ThrowTypeError("Response data must be a Buffer");
             }
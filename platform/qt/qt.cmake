@@ -17,6 +17,7 @@ set(MBGL_QT_FILES
     PRIVATE platform/default/asset_file_source.cpp
     PRIVATE platform/default/default_file_source.cpp
     PRIVATE platform/default/local_file_source.cpp
+    PRIVATE platform/default/mbtiles_file_source.cpp
     PRIVATE platform/default/online_file_source.cpp
 
     # Offline
@@ -25,6 +26,8 @@ set(MBGL_QT_FILES
     PRIVATE platform/default/mbgl/storage/offline_database.hpp
     PRIVATE platform/default/mbgl/storage/offline_download.cpp
     PRIVATE platform/default/mbgl/storage/offline_download.hpp
+    PRIVATE platform/default/mbgl/storage/response_cache.cpp
+    PRIVATE platform/default/mbgl/storage/response_cache.hpp
     PRIVATE platform/default/sqlite3.cpp
     PRIVATE platform/default/sqlite3.hpp
 
@@ -34,6 +37,10 @@ set(MBGL_QT_FILES
     # Thread pool
     PRIVATE platform/default/mbgl/util/default_thread_pool.cpp
     PRIVATE platform/default/mbgl/util/default_thread_pool.cpp
+    PRIVATE platform/default/mbgl/util/work_stealing_thread_pool.cpp
+    PRIVATE platform/default/mbgl/util/work_stealing_thread_pool.hpp
+    PRIVATE platform/default/mbgl/util/elastic_thread_pool.cpp
+    PRIVATE platform/default/mbgl/util/elastic_thread_pool.hpp
 
     # Platform integration
     PRIVATE platform/qt/src/async_task.cpp
@@ -93,12 +93,9 @@ void HTTPRequest::handleNetworkReply(QNetworkReply *reply)
 
     switch(responseCode) {
     case 200: {
-        QByteArray bytes = reply->readAll();
-        if (bytes.isEmpty()) {
-            response.data = std::make_shared<std::string>();
-        } else {
-            response.data = std::make_shared<std::string>(bytes.constData(), bytes.size());
-        }
+        // Share the bytes of the reply instead of copying them.
+        auto bytes = std::make_shared<const QByteArray>(reply->readAll());
+        response.data = ByteBuffer(bytes, bytes->constData(), static_cast<std::size_t>(bytes->size()));
         break;
     }
     case 204:
@@ -22,6 +22,14 @@ namespace mbgl {
     to R is *not* guaranteed (and can't be: S1 and S2 may be acting asynchronously with respect
     to each other).
 
+    The mailbox itself is a lock-free queue: sending a message never blocks on the receiver.
+    When scheduled, an actor processes a batch of pending messages (see `Mailbox::receive`)
+    before yielding its thread, rather than a single one.
+
+    An actor's mailbox can be given a `Mailbox::Priority` (using `setPriority`). Schedulers
+    that support priorities process the pending messages of higher priority actors first.
+    This does not affect the ordering guarantees above.
+
     An `Actor<O>` can be converted to an `ActorRef<O>`, a non-owning value object representing
     a (weak) reference to the actor. Messages can be sent via the `Ref` as well.
 
@@ -40,7 +48,9 @@ namespace mbgl {
     can use to self-send messages), followed by the forwarded arguments passed to `Actor<O>`.
 
     Please don't send messages that contain shared pointers or references. That subverts the
-    purpose of the actor model: prohibiting direct concurrent access to shared state.
+    purpose of the actor model: prohibiting direct concurrent access to shared state. The one
+    exception is `std::shared_ptr<const T>` to data that is never mutated after it has been
+    sent, such as the layer snapshots returned by `Style::getLayerSnapshot`.
 */
 
 template <class Object>
@@ -61,6 +71,10 @@ public:
         mailbox->push(actor::makeMessage(object, fn, std::forward<Args>(args)...));
     }
 
+    void setPriority(Mailbox::Priority priority) {
+        mailbox->setPriority(priority);
+    }
+
     ActorRef<std::decay_t<Object>> self() {
         return ActorRef<std::decay_t<Object>>(object, mailbox);
     }
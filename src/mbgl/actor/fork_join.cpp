@@ -0,0 +1,75 @@
+#include <mbgl/actor/fork_join.hpp>
+#include <mbgl/actor/mailbox.hpp>
+#include <mbgl/actor/message.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace mbgl {
+
+namespace {
+
+class Join {
+public:
+    Join(std::size_t count_, const std::function<void (std::size_t)>& task_)
+        : count(count_),
+          task(task_) {
+    }
+
+    // Claims and runs tasks until none are left unclaimed.
+    void work() {
+        for (std::size_t i = next++; i < count; i = next++) {
+            try {
+                task(i);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        }
+    }
+
+    std::exception_ptr getError() const {
+        return error;
+    }
+
+private:
+    const std::size_t count;
+    const std::function<void (std::size_t)>& task;
+    std::atomic<std::size_t> next { 0 };
+
+    std::mutex mutex;
+    std::exception_ptr error;
+};
+
+} // namespace
+
+void forkJoin(Scheduler& scheduler, std::size_t helpers, std::size_t count, const std::function<void (std::size_t)>& task) {
+    Join join(count, task);
+
+    std::vector<std::shared_ptr<Mailbox>> mailboxes;
+    for (std::size_t i = 0; i + 1 < count && i < helpers; ++i) {
+        mailboxes.push_back(std::make_shared<Mailbox>(scheduler));
+        mailboxes.back()->push(actor::makeMessage(join, &Join::work));
+    }
+
+    join.work();
+
+    // By now every task has been claimed. Closing a mailbox blocks until its helper is done
+    // with the task it claimed, if any, and keeps a helper that hasn't started yet from
+    // ever touching `join`.
+    for (auto& mailbox : mailboxes) {
+        mailbox->close();
+    }
+
+    if (join.getError()) {
+        std::rethrow_exception(join.getError());
+    }
+}
+
+} // namespace mbgl
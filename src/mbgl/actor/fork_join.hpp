@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace mbgl {
+
+class Scheduler;
+
+/*
+    Runs `task(i)` for every `i` in `[0, count)` and returns once all of them have finished.
+
+    The calling thread works through the tasks itself, while up to `helpers` mailboxes
+    scheduled on `scheduler` let otherwise idle threads pick up tasks concurrently. Since the
+    caller never waits for a task that no thread has started yet, this is safe to call from a
+    thread that belongs to `scheduler`, such as from within an actor, even if every other
+    thread of the pool is busy.
+
+    Tasks may run in any order and on any thread, so they must be independent of each other.
+    If any of them throws, the remaining tasks still run, and the first exception is rethrown
+    to the caller.
+*/
+
+void forkJoin(Scheduler&, std::size_t helpers, std::size_t count, const std::function<void (std::size_t)>& task);
+
+} // namespace mbgl
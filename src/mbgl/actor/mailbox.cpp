@@ -1,11 +1,15 @@
 #include <mbgl/actor/mailbox.hpp>
 #include <mbgl/actor/message.hpp>
 #include <mbgl/actor/scheduler.hpp>
+#include <mbgl/actor/scheduler_statistics.hpp>
 
 #include <cassert>
 
 namespace mbgl {
 
+constexpr std::size_t Mailbox::maxBatchSize;
+constexpr Duration Mailbox::maxBatchDuration;
+
 Mailbox::Mailbox(Scheduler& scheduler_)
     : scheduler(scheduler_) {
 }
@@ -13,14 +17,23 @@ Mailbox::Mailbox(Scheduler& scheduler_)
 void Mailbox::push(std::unique_ptr<Message> message) {
     assert(!closing);
 
-    std::lock_guard<std::mutex> queueLock(queueMutex);
-    bool wasEmpty = queue.empty();
+    // Count the message before it's visible in the queue, so that `receive()` can never
+    // account for more messages than it has been scheduled for.
+    bool wasEmpty = size++ == 0;
     queue.push(std::move(message));
     if (wasEmpty) {
         scheduler.schedule(shared_from_this());
     }
 }
 
+void Mailbox::setPriority(Priority priority_) {
+    priority = priority_;
+}
+
+Mailbox::Priority Mailbox::getPriority() const {
+    return priority;
+}
+
 void Mailbox::close() {
     // Block until the scheduler is guaranteed not to be executing receive().
     std::lock_guard<std::mutex> closingLock(closingMutex);
@@ -34,20 +47,39 @@ void Mailbox::receive() {
         return;
     }
 
-    std::unique_ptr<Message> message;
-    bool wasEmpty;
-
-    {
-        std::lock_guard<std::mutex> queueLock(queueMutex);
-        assert(!queue.empty());
-        message = std::move(queue.front());
-        queue.pop();
-        wasEmpty = queue.empty();
+    SchedulerStatistics* statistics = scheduler.getStatistics();
+    if (statistics && !statistics->isEnabled()) {
+        statistics = nullptr;
     }
 
-    (*message)();
+    TimePoint now = Clock::now();
+    const TimePoint deadline = now + maxBatchDuration;
+    std::size_t received = 0;
+
+    while (received < maxBatchSize) {
+        // May be null if a concurrent push() hasn't finished linking its message yet;
+        // in that case `size` is still non-zero and we'll be rescheduled below.
+        std::unique_ptr<Message> message = queue.pop();
+        if (!message) {
+            break;
+        }
+
+        (*message)();
+        ++received;
+
+        const TimePoint start = now;
+        now = Clock::now();
+
+        if (statistics && statistics->sample()) {
+            statistics->recordExecutionTime(message->type(), now - start);
+        }
+
+        if (now >= deadline) {
+            break;
+        }
+    }
 
-    if (!wasEmpty) {
+    if (size.fetch_sub(received) > received) {
         scheduler.schedule(shared_from_this());
     }
 }
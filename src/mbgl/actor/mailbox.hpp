@@ -1,8 +1,12 @@
 #pragma once
 
+#include <mbgl/actor/message_queue.hpp>
+#include <mbgl/util/chrono.hpp>
+
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <mutex>
-#include <queue>
 
 namespace mbgl {
 
@@ -11,10 +15,28 @@ class Message;
 
 class Mailbox : public std::enable_shared_from_this<Mailbox> {
 public:
+    // A hint to the `Scheduler` about the order in which pending mailboxes should be
+    // processed. Schedulers that support it pick higher priority mailboxes first; the
+    // relative order of mailboxes with equal priority is unchanged.
+    enum class Priority : uint8_t {
+        Low,
+        Normal,
+        High,
+    };
+
+    // Each time the mailbox is scheduled, `receive()` processes pending messages until
+    // either limit is reached, and then reschedules itself if there are more.
+    static constexpr std::size_t maxBatchSize = 32;
+    static constexpr Duration maxBatchDuration = std::chrono::milliseconds(1);
+
     Mailbox(Scheduler&);
 
     void push(std::unique_ptr<Message>);
 
+    // Takes effect the next time the mailbox is scheduled.
+    void setPriority(Priority);
+    Priority getPriority() const;
+
     void close();
     void receive();
 
@@ -23,11 +45,15 @@ public:
 private:
     Scheduler& scheduler;
 
+    std::atomic<Priority> priority { Priority::Normal };
+
     std::mutex closingMutex;
     bool closing { false };
 
-    std::mutex queueMutex;
-    std::queue<std::unique_ptr<Message>> queue;
+    // Number of messages pushed but not yet received. The mailbox is scheduled exactly
+    // when this goes from zero to non-zero, or when `receive()` leaves messages behind.
+    std::atomic<std::size_t> size { 0 };
+    MessageQueue queue;
 };
 
 } // namespace mbgl
@@ -1,9 +1,15 @@
 #pragma once
 
+#include <atomic>
+#include <memory>
+#include <tuple>
+#include <typeinfo>
 #include <utility>
 
 namespace mbgl {
 
+class MessageQueue;
+
 // A movable type-erasing function wrapper. This allows to store arbitrary invokable
 // things (like std::function<>, or the result of a movable-only std::bind()) in the queue.
 // Source: http://stackoverflow.com/a/29642072/331379
@@ -11,6 +17,15 @@ class Message {
 public:
     virtual ~Message() = default;
     virtual void operator()() = 0;
+
+    // Identifies the kind of message for instrumentation (see `SchedulerStatistics`).
+    virtual const char* type() const { return typeid(*this).name(); }
+
+private:
+    friend class MessageQueue;
+
+    // Link to the next message in a `MessageQueue`.
+    std::atomic<Message*> next { nullptr };
 };
 
 template <class Object, class MemberFn, class ArgsTuple>
@@ -26,6 +41,10 @@ public:
         invoke(std::make_index_sequence<std::tuple_size<ArgsTuple>::value>());
     }
 
+    const char* type() const override {
+        return typeid(MemberFn).name();
+    }
+
     template <std::size_t... I>
     void invoke(std::index_sequence<I...>) {
         (object.*memberFn)(std::move(std::get<I>(argsTuple))...);
@@ -0,0 +1,61 @@
+#include <mbgl/actor/message_queue.hpp>
+
+namespace mbgl {
+
+MessageQueue::MessageQueue()
+    : head(&stub),
+      tail(&stub) {
+}
+
+MessageQueue::~MessageQueue() {
+    // Destroy any messages that were never received.
+    while (pop()) {
+    }
+}
+
+void MessageQueue::push(std::unique_ptr<Message> message) {
+    push(message.release());
+}
+
+void MessageQueue::push(Message* message) {
+    message->next.store(nullptr, std::memory_order_relaxed);
+    Message* prev = head.exchange(message, std::memory_order_acq_rel);
+    prev->next.store(message, std::memory_order_release);
+}
+
+std::unique_ptr<Message> MessageQueue::pop() {
+    Message* first = tail;
+    Message* next = first->next.load(std::memory_order_acquire);
+
+    if (first == &stub) {
+        if (!next) {
+            return nullptr;
+        }
+        tail = next;
+        first = next;
+        next = next->next.load(std::memory_order_acquire);
+    }
+
+    if (next) {
+        tail = next;
+        return std::unique_ptr<Message>(first);
+    }
+
+    if (first != head.load(std::memory_order_acquire)) {
+        // A producer has swapped the head but hasn't linked its message yet.
+        return nullptr;
+    }
+
+    // `first` is the last message; re-insert the stub so that it can be unlinked.
+    push(&stub);
+
+    next = first->next.load(std::memory_order_acquire);
+    if (next) {
+        tail = next;
+        return std::unique_ptr<Message>(first);
+    }
+
+    return nullptr;
+}
+
+} // namespace mbgl
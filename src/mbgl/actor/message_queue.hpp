@@ -0,0 +1,49 @@
+#pragma once
+
+#include <mbgl/actor/message.hpp>
+#include <mbgl/util/noncopyable.hpp>
+
+#include <atomic>
+#include <memory>
+
+namespace mbgl {
+
+/*
+    A `MessageQueue` is an intrusive, lock-free, multiple-producer single-consumer FIFO
+    queue of `Message`s, used as the backing store of a `Mailbox`.
+
+    Any number of threads may `push` concurrently, but only a single thread at a time
+    may `pop`. Messages pushed by any one thread are popped in the order they were pushed.
+
+    The queue is linked through `Message::next`, so pushing doesn't allocate. It's based
+    on Dmitry Vyukov's intrusive MPSC node-based queue:
+    http://www.1024cores.net/home/lock-free-algorithms/queues/intrusive-mpsc-node-based-queue
+
+    `pop` can transiently return null while a concurrent `push` is halfway through linking
+    its message. Callers that know the queue is non-empty (see `Mailbox`) simply retry later.
+*/
+
+class MessageQueue : private util::noncopyable {
+public:
+    MessageQueue();
+    ~MessageQueue();
+
+    void push(std::unique_ptr<Message>);
+    std::unique_ptr<Message> pop();
+
+private:
+    void push(Message*);
+
+    class Stub : public Message {
+    public:
+        void operator()() override {}
+    };
+
+    Stub stub;
+
+    // Producers append at the head, the consumer removes from the tail.
+    std::atomic<Message*> head;
+    Message* tail;
+};
+
+} // namespace mbgl
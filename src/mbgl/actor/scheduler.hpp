@@ -1,10 +1,12 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
 
 namespace mbgl {
 
 class Mailbox;
+class SchedulerStatistics;
 
 /*
     A `Scheduler` is responsible for coordinating the processing of messages by
@@ -19,7 +21,16 @@ class Mailbox;
         concurrency within a mailbox
 
       Subject to these constraints, processing can happen on whatever thread in the
-      pool is available.
+      pool is available. Pending mailboxes are processed in order of their
+      `Mailbox::Priority`, and in FIFO order within the same priority.
+
+    * `WorkStealingThreadPool` provides the same guarantees as `ThreadPool`, but keeps
+      a separate queue per thread instead of a single shared one, and lets idle threads
+      steal work from busy ones.
+
+    * `ElasticThreadPool` provides the same guarantees as `ThreadPool`, but starts and
+      stops threads between a minimum and a maximum count depending on load. A shared,
+      process-wide instance is available.
 
     * `RunLoop` is a `Scheduler` that is typically used to create a mailbox and
       `ActorRef` for an object that lives on the main thread and is not itself wrapped
@@ -33,6 +44,14 @@ class Scheduler {
 public:
     virtual ~Scheduler() = default;
     virtual void schedule(std::weak_ptr<Mailbox>) = 0;
+
+    // The number of messages that the scheduler can process at the same time, i.e. the number
+    // of threads it has, or can have.
+    virtual std::size_t getConcurrency() const { return 1; }
+
+    // Schedulers that support instrumentation return their statistics; they are collected
+    // once enabled. See `SchedulerStatistics`.
+    virtual SchedulerStatistics* getStatistics() { return nullptr; }
 };
 
 } // namespace mbgl
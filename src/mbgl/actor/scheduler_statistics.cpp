@@ -0,0 +1,248 @@
+#include <mbgl/actor/scheduler_statistics.hpp>
+
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#include <cstdlib>
+#endif
+
+#include <algorithm>
+#include <functional>
+#include <thread>
+
+namespace mbgl {
+
+constexpr std::size_t Histogram::bucketCount;
+
+void Histogram::record(uint64_t value) {
+    std::size_t bucket = 0;
+    while (bucket + 1 < bucketCount && value >> bucket) {
+        ++bucket;
+    }
+
+    buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    count.fetch_add(1, std::memory_order_relaxed);
+    sum.fetch_add(value, std::memory_order_relaxed);
+
+    uint64_t previous = max.load(std::memory_order_relaxed);
+    while (previous < value && !max.compare_exchange_weak(previous, value, std::memory_order_relaxed)) {
+    }
+}
+
+void Histogram::reset() {
+    for (auto& bucket : buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    count.store(0, std::memory_order_relaxed);
+    sum.store(0, std::memory_order_relaxed);
+    max.store(0, std::memory_order_relaxed);
+}
+
+Histogram::Snapshot Histogram::snapshot() const {
+    Snapshot result;
+    result.count = count.load(std::memory_order_relaxed);
+    result.sum = sum.load(std::memory_order_relaxed);
+    result.max = max.load(std::memory_order_relaxed);
+    for (std::size_t i = 0; i < bucketCount; ++i) {
+        result.buckets[i] = buckets[i].load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
+constexpr std::size_t SchedulerStatistics::sampleCounterStripes;
+constexpr std::size_t SchedulerStatistics::typeSlotCount;
+
+// Spreads pointers and thread IDs, whose low bits tend to be alike, over a power-of-two range.
+static std::size_t spread(std::size_t hash, std::size_t range) {
+    return static_cast<std::size_t>((uint64_t(hash) * 0x9E3779B97F4A7C15ULL) >> 40) & (range - 1);
+}
+
+SchedulerStatistics::SchedulerStatistics(std::size_t workers)
+    : busyTime(workers) {
+}
+
+void SchedulerStatistics::enable(std::size_t sampleInterval_) {
+    sampleInterval = std::max<std::size_t>(sampleInterval_, 1);
+
+    waitTime.reset();
+    queueDepth.reset();
+    {
+        std::lock_guard<std::mutex> lock(executionTimeMutex);
+        for (auto& entry : executionTime) {
+            entry.second->reset();
+        }
+    }
+    for (auto& busy : busyTime) {
+        busy = 0;
+    }
+
+    enabledSince = Clock::now().time_since_epoch().count();
+    enabled = true;
+}
+
+void SchedulerStatistics::disable() {
+    enabled = false;
+}
+
+bool SchedulerStatistics::isEnabled() const {
+    return enabled.load(std::memory_order_relaxed);
+}
+
+bool SchedulerStatistics::sample() {
+    if (!isEnabled()) {
+        return false;
+    }
+    const std::size_t stripe = spread(std::hash<std::thread::id>()(std::this_thread::get_id()), sampleCounterStripes);
+    return sampleCounters[stripe].value.fetch_add(1, std::memory_order_relaxed) %
+        sampleInterval.load(std::memory_order_relaxed) == 0;
+}
+
+void SchedulerStatistics::recordWaitTime(Duration duration) {
+    waitTime.record(std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+}
+
+void SchedulerStatistics::recordQueueDepth(std::size_t depth) {
+    queueDepth.record(depth);
+}
+
+void SchedulerStatistics::recordExecutionTime(const char* type, Duration duration) {
+    executionTimeHistogram(type).record(std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+}
+
+Histogram& SchedulerStatistics::executionTimeHistogram(const char* type) {
+    const std::size_t start = spread(std::hash<const char*>()(type), typeSlotCount);
+
+    for (std::size_t i = 0; i < typeSlotCount; ++i) {
+        const TypeSlot& slot = typeSlots[(start + i) & (typeSlotCount - 1)];
+        const char* slotType = slot.type.load(std::memory_order_acquire);
+        if (slotType == type) {
+            return *slot.histogram.load(std::memory_order_relaxed);
+        } else if (!slotType) {
+            break;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(executionTimeMutex);
+
+    auto& entry = executionTime[type];
+    if (!entry) {
+        entry = std::make_unique<Histogram>();
+    }
+
+    // Another thread may have added the type since the lookup above. If the table is full,
+    // later messages of this type come back here.
+    for (std::size_t i = 0; i < typeSlotCount; ++i) {
+        TypeSlot& slot = typeSlots[(start + i) & (typeSlotCount - 1)];
+        const char* slotType = slot.type.load(std::memory_order_relaxed);
+        if (slotType == type) {
+            break;
+        } else if (!slotType) {
+            slot.histogram.store(entry.get(), std::memory_order_relaxed);
+            slot.type.store(type, std::memory_order_release);
+            break;
+        }
+    }
+
+    return *entry;
+}
+
+void SchedulerStatistics::recordBusyTime(std::size_t worker, Duration duration) {
+    busyTime[worker].fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count(),
+                               std::memory_order_relaxed);
+}
+
+static std::string typeName(const std::string& name) {
+#if defined(__GNUG__)
+    int status = 0;
+    char* demangled = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+    if (status == 0 && demangled) {
+        std::string result(demangled);
+        std::free(demangled);
+        return result;
+    }
+#endif
+    return name;
+}
+
+SchedulerStatistics::Snapshot SchedulerStatistics::snapshot() const {
+    Snapshot result;
+    result.waitTime = waitTime.snapshot();
+    result.queueDepth = queueDepth.snapshot();
+
+    {
+        std::lock_guard<std::mutex> lock(executionTimeMutex);
+        for (const auto& entry : executionTime) {
+            result.executionTime.emplace(typeName(entry.first), entry.second->snapshot());
+        }
+    }
+
+    const auto elapsed = Clock::now().time_since_epoch().count() - enabledSince.load();
+    const double elapsedNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(Duration(elapsed)).count();
+    for (const auto& busy : busyTime) {
+        result.utilization.push_back(elapsedNanoseconds > 0 ? busy / elapsedNanoseconds : 0);
+    }
+
+    return result;
+}
+
+template <class Writer>
+static void writeHistogram(Writer& writer, const Histogram::Snapshot& histogram) {
+    writer.StartObject();
+    writer.Key("count");
+    writer.Uint64(histogram.count);
+    writer.Key("sum");
+    writer.Uint64(histogram.sum);
+    writer.Key("max");
+    writer.Uint64(histogram.max);
+
+    // Trailing empty buckets are left out.
+    auto last = std::find_if(histogram.buckets.rbegin(), histogram.buckets.rend(), [] (uint64_t n) {
+        return n != 0;
+    });
+
+    writer.Key("buckets");
+    writer.StartArray();
+    for (auto it = histogram.buckets.begin(); it != last.base(); ++it) {
+        writer.Uint64(*it);
+    }
+    writer.EndArray();
+    writer.EndObject();
+}
+
+std::string SchedulerStatistics::toJSON() const {
+    const Snapshot statistics = snapshot();
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+
+    writer.StartObject();
+
+    writer.Key("waitTime");
+    writeHistogram(writer, statistics.waitTime);
+
+    writer.Key("queueDepth");
+    writeHistogram(writer, statistics.queueDepth);
+
+    writer.Key("executionTime");
+    writer.StartObject();
+    for (const auto& entry : statistics.executionTime) {
+        writer.Key(entry.first.c_str());
+        writeHistogram(writer, entry.second);
+    }
+    writer.EndObject();
+
+    writer.Key("utilization");
+    writer.StartArray();
+    for (double utilization : statistics.utilization) {
+        writer.Double(utilization);
+    }
+    writer.EndArray();
+
+    writer.EndObject();
+
+    return buffer.GetString();
+}
+
+} // namespace mbgl
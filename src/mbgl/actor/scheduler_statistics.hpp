@@ -0,0 +1,134 @@
+#pragma once
+
+#include <mbgl/util/chrono.hpp>
+#include <mbgl/util/noncopyable.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace mbgl {
+
+/*
+    A `Histogram` counts values in power-of-two buckets: bucket 0 counts zeros, and bucket `i`
+    counts values in `[2^(i-1), 2^i)`. Recording is lock-free, so any number of threads may
+    record values concurrently.
+*/
+class Histogram : private util::noncopyable {
+public:
+    static constexpr std::size_t bucketCount = 40;
+
+    class Snapshot {
+    public:
+        uint64_t count = 0;
+        uint64_t sum = 0;
+        uint64_t max = 0;
+        std::array<uint64_t, bucketCount> buckets {};
+    };
+
+    void record(uint64_t value);
+    Snapshot snapshot() const;
+
+    // Not atomic with respect to concurrent `record` calls, which may be partially kept.
+    void reset();
+
+private:
+    std::array<std::atomic<uint64_t>, bucketCount> buckets {};
+    std::atomic<uint64_t> count { 0 };
+    std::atomic<uint64_t> sum { 0 };
+    std::atomic<uint64_t> max { 0 };
+};
+
+/*
+    `SchedulerStatistics` collects instrumentation for a `Scheduler` and the mailboxes that it
+    runs:
+
+    * `waitTime`: microseconds from a mailbox being scheduled until a thread starts receiving it
+    * `queueDepth`: the number of mailboxes already waiting whenever one is scheduled
+    * `executionTime`: microseconds spent processing a message, per message type. The type is
+      the signature of the member function that the message invokes.
+    * `utilization`: the fraction of time, since statistics were enabled, that each worker
+      thread spent receiving messages
+
+    Statistics are disabled by default. Checking for that costs a relaxed atomic load for
+    every batch of messages. When enabled, one in every `sampleInterval` scheduled mailboxes
+    and received messages is sampled. Worker utilization is always measured in full. Enabling
+    statistics discards everything recorded before.
+
+    Sampling and recording don't take locks: the sample counters are striped by thread, and
+    the histogram of a message type is found by the address of its name. Only the first
+    message of each type looks it up by name, under a lock.
+*/
+class SchedulerStatistics : private util::noncopyable {
+public:
+    SchedulerStatistics(std::size_t workers);
+
+    void enable(std::size_t sampleInterval = 1);
+    void disable();
+    bool isEnabled() const;
+
+    class Snapshot {
+    public:
+        Histogram::Snapshot waitTime;
+        Histogram::Snapshot queueDepth;
+        std::map<std::string, Histogram::Snapshot> executionTime;
+        std::vector<double> utilization;
+    };
+
+    Snapshot snapshot() const;
+    std::string toJSON() const;
+
+    // Called by schedulers and mailboxes. `sample()` returns whether the next event should be
+    // recorded.
+    bool sample();
+    void recordWaitTime(Duration);
+    void recordQueueDepth(std::size_t);
+    void recordExecutionTime(const char* type, Duration);
+    void recordBusyTime(std::size_t worker, Duration);
+
+private:
+    Histogram& executionTimeHistogram(const char* type);
+
+    std::atomic<bool> enabled { false };
+    std::atomic<std::size_t> sampleInterval { 1 };
+    std::atomic<TimePoint::rep> enabledSince { 0 };
+
+    // Each thread counts its events on the stripe that its ID hashes to, padded to a cache
+    // line so that threads on different stripes don't contend.
+    class SampleCounter {
+    public:
+        std::atomic<std::size_t> value { 0 };
+        char padding[64 - sizeof(std::atomic<std::size_t>)];
+    };
+    static constexpr std::size_t sampleCounterStripes = 16;
+    std::array<SampleCounter, sampleCounterStripes> sampleCounters;
+
+    Histogram waitTime;
+    Histogram queueDepth;
+
+    // Keyed by the name rather than the pointer, which may differ between libraries that use
+    // the same message type. Histograms are never removed, so pointers to them stay valid.
+    mutable std::mutex executionTimeMutex;
+    std::unordered_map<std::string, std::unique_ptr<Histogram>> executionTime;
+
+    // An open-addressed table from the address of a type name to its histogram, which is
+    // read without locking. Slots are filled under `executionTimeMutex`, and never change
+    // once filled.
+    class TypeSlot {
+    public:
+        std::atomic<const char*> type;
+        std::atomic<Histogram*> histogram;
+    };
+    static constexpr std::size_t typeSlotCount = 256;
+    std::array<TypeSlot, typeSlotCount> typeSlots {};
+
+    std::vector<std::atomic<uint64_t>> busyTime;
+};
+
+} // namespace mbgl
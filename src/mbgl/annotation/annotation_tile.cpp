@@ -19,8 +19,6 @@ AnnotationTile::~AnnotationTile() {
     annotationManager.removeTile(*this);
 }
 
-void AnnotationTile::setNecessity(Necessity) {}
-
 AnnotationTileFeature::AnnotationTileFeature(const AnnotationID id_,
                                              FeatureType type_, GeometryCollection geometries_,
                                              std::unordered_map<std::string, std::string> properties_)
@@ -40,10 +38,6 @@ optional<Value> AnnotationTileFeature::getValue(const std::string& key) const {
 AnnotationTileLayer::AnnotationTileLayer(std::string name_)
     : name(std::move(name_)) {}
 
-std::unique_ptr<GeometryTileData> AnnotationTileData::clone() const {
-    return std::make_unique<AnnotationTileData>(*this);
-}
-
 const GeometryTileLayer* AnnotationTileData::getLayer(const std::string& name) const {
     auto it = layers.find(name);
     if (it != layers.end()) {
@@ -18,8 +18,6 @@ public:
                    const style::UpdateParameters&);
     ~AnnotationTile() override;
 
-    void setNecessity(Necessity) final;
-
 private:
     AnnotationManager& annotationManager;
 };
@@ -56,7 +54,6 @@ private:
 
 class AnnotationTileData : public GeometryTileData {
 public:
-    std::unique_ptr<GeometryTileData> clone() const override;
     const GeometryTileLayer* getLayer(const std::string&) const override;
 
     std::unordered_map<std::string, AnnotationTileLayer> layers;
@@ -1,4 +1,5 @@
 #include <mbgl/geometry/feature_index.hpp>
+#include <mbgl/tile/flat_geometry.hpp>
 #include <mbgl/style/style.hpp>
 #include <mbgl/style/layer.hpp>
 #include <mbgl/style/layer_impl.hpp>
@@ -19,14 +20,41 @@ FeatureIndex::FeatureIndex()
     : grid(util::EXTENT, 16, 0) {
 }
 
-void FeatureIndex::insert(const GeometryCollection& geometries,
+void FeatureIndex::insert(const FlatGeometry& geometry,
                           std::size_t index,
                           const std::string& sourceLayerName,
                           const std::string& bucketName) {
-    for (const auto& ring : geometries) {
+    auto& range = bucketRanges.emplace(bucketName, std::make_pair(grid.getElements().size(),
+                                                                  grid.getElements().size())).first->second;
+    assert(range.second == grid.getElements().size());
+
+    for (std::size_t i = 0; i < geometry.ringCount(); ++i) {
         grid.insert(IndexedSubfeature { index, sourceLayerName, bucketName, sortIndex++ },
-                    mapbox::geometry::envelope(ring));
+                    mapbox::geometry::envelope(geometry.ring(i)));
+    }
+
+    range.second = grid.getElements().size();
+}
+
+void FeatureIndex::insertBucket(const FeatureIndex& other, const std::string& bucketName) {
+    auto it = other.bucketRanges.find(bucketName);
+    if (it == other.bucketRanges.end()) {
+        return;
     }
+
+    const auto& elements = other.grid.getElements();
+    auto& range = bucketRanges.emplace(bucketName, std::make_pair(grid.getElements().size(),
+                                                                  grid.getElements().size())).first->second;
+
+    // Entries are re-numbered, so that their sort order matches the order in which
+    // buckets are inserted into this index.
+    for (std::size_t i = it->second.first; i < it->second.second; ++i) {
+        IndexedSubfeature feature = elements[i].first;
+        feature.sortIndex = sortIndex++;
+        grid.insert(std::move(feature), elements[i].second);
+    }
+
+    range.second = grid.getElements().size();
 }
 
 static bool vectorContains(const std::vector<std::string>& vector, const std::string& s) {
@@ -158,4 +186,8 @@ void FeatureIndex::setCollisionTile(std::unique_ptr<CollisionTile> collisionTile
     collisionTile = std::move(collisionTile_);
 }
 
+std::unique_ptr<CollisionTile> FeatureIndex::releaseCollisionTile() {
+    return std::move(collisionTile);
+}
+
 } // namespace mbgl
@@ -5,6 +5,7 @@
 #include <mbgl/util/grid_index.hpp>
 #include <mbgl/util/feature.hpp>
 
+#include <memory>
 #include <vector>
 #include <string>
 #include <unordered_map>
@@ -17,6 +18,7 @@ class Style;
 
 class CollisionTile;
 class CanonicalTileID;
+class FlatGeometry;
 
 class IndexedSubfeature {
 public:
@@ -31,7 +33,11 @@ class FeatureIndex {
 public:
     FeatureIndex();
 
-    void insert(const GeometryCollection&, std::size_t index, const std::string& sourceLayerName, const std::string& bucketName);
+    void insert(const FlatGeometry&, std::size_t index, const std::string& sourceLayerName, const std::string& bucketName);
+
+    // Inserts the entries of a bucket from another index, e.g. one built by a previous layout
+    // of the same tile data, without reparsing its features.
+    void insertBucket(const FeatureIndex&, const std::string& bucketName);
 
     void query(
             std::unordered_map<std::string, std::vector<Feature>>& result,
@@ -54,6 +60,10 @@ public:
     void addBucketLayerName(const std::string& bucketName, const std::string& layerName);
 
     void setCollisionTile(std::unique_ptr<CollisionTile>);
+    std::unique_ptr<CollisionTile> releaseCollisionTile();
+
+    // The memory taken up by the index, not counting the names that its entries refer to.
+    std::size_t byteSize() const { return grid.byteSize(); }
 
 private:
     void addFeature(
@@ -72,5 +82,9 @@ private:
     unsigned int sortIndex = 0;
 
     std::unordered_map<std::string, std::vector<std::string>> bucketLayerIDs;
+
+    // Range of grid elements belonging to each bucket. Buckets are built one at a time,
+    // so the entries of a bucket are always contiguous.
+    std::unordered_map<std::string, std::pair<std::size_t, std::size_t>> bucketRanges;
 };
 } // namespace mbgl
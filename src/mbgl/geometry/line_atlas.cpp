@@ -131,6 +131,10 @@ void LineAtlas::upload(gl::Context& context, gl::TextureUnit unit) {
     dirty = false;
 }
 
+void LineAtlas::releaseTexture() {
+    texture = {};
+}
+
 void LineAtlas::bind(gl::Context& context, gl::TextureUnit unit) {
     upload(context, unit);
     context.bindTexture(*texture, unit, gl::TextureFilter::Linear, gl::TextureMipMap::No,
@@ -34,6 +34,28 @@ static_assert(std::is_same<std::underlying_type_t<TextureFormat>, GLenum>::value
 static_assert(underlying_type(TextureFormat::RGBA) == GL_RGBA, "OpenGL type mismatch");
 static_assert(underlying_type(TextureFormat::Alpha) == GL_ALPHA, "OpenGL type mismatch");
 
+namespace {
+
+template <class ID>
+void track(std::unordered_map<ID, std::size_t>& sizes, std::size_t& total, ID id, std::size_t size) {
+    std::size_t& entry = sizes[id];
+    total = total - entry + size;
+    entry = size;
+}
+
+template <class ID>
+bool untrack(std::unordered_map<ID, std::size_t>& sizes, std::size_t& total, ID id) {
+    auto it = sizes.find(id);
+    if (it == sizes.end()) {
+        return false;
+    }
+    total -= it->second;
+    sizes.erase(it);
+    return true;
+}
+
+} // namespace
+
 Context::~Context() {
     reset();
 }
@@ -98,6 +120,7 @@ UniqueBuffer Context::createVertexBuffer(const void* data, std::size_t size) {
     UniqueBuffer result { std::move(id), { this } };
     vertexBuffer = result;
     MBGL_CHECK_ERROR(glBufferData(GL_ARRAY_BUFFER, size, data, GL_STATIC_DRAW));
+    track(vertexBufferSizes, memoryStats.vertexBuffers, result.get(), size);
     return result;
 }
 
@@ -108,6 +131,7 @@ UniqueBuffer Context::createIndexBuffer(const void* data, std::size_t size) {
     vertexArrayObject = 0;
     elementBuffer = result;
     MBGL_CHECK_ERROR(glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, data, GL_STATIC_DRAW));
+    track(indexBufferSizes, memoryStats.indexBuffers, result.get(), size);
     return result;
 }
 
@@ -136,6 +160,9 @@ UniqueRenderbuffer Context::createRenderbuffer(const RenderbufferType type, cons
     bindRenderbuffer = renderbuffer;
     MBGL_CHECK_ERROR(
         glRenderbufferStorage(GL_RENDERBUFFER, static_cast<GLenum>(type), size.width, size.height));
+    // Both RGBA8 and DEPTH24_STENCIL8 take four bytes per pixel.
+    track(renderbufferSizes, memoryStats.renderbuffers, renderbuffer.get(),
+          std::size_t(size.width) * size.height * 4);
     return renderbuffer;
 }
 
@@ -290,6 +317,8 @@ void Context::updateTexture(
     MBGL_CHECK_ERROR(glTexImage2D(GL_TEXTURE_2D, 0, static_cast<GLenum>(format), size.width,
                                   size.height, 0, static_cast<GLenum>(format), GL_UNSIGNED_BYTE,
                                   data));
+    track(textureSizes, memoryStats.textures, id,
+          std::size_t(size.width) * size.height * (format == TextureFormat::RGBA ? 4 : 1));
 }
 
 void Context::bindTexture(Texture& obj,
@@ -548,6 +577,9 @@ void Context::performCleanup() {
             } else if (elementBuffer == id) {
                 elementBuffer.setDirty();
             }
+            if (!untrack(vertexBufferSizes, memoryStats.vertexBuffers, id)) {
+                untrack(indexBufferSizes, memoryStats.indexBuffers, id);
+            }
         }
         MBGL_CHECK_ERROR(glDeleteBuffers(int(abandonedBuffers.size()), abandonedBuffers.data()));
         abandonedBuffers.clear();
@@ -558,6 +590,7 @@ void Context::performCleanup() {
             if (activeTexture == id) {
                 activeTexture.setDirty();
             }
+            untrack(textureSizes, memoryStats.textures, id);
         }
         MBGL_CHECK_ERROR(glDeleteTextures(int(abandonedTextures.size()), abandonedTextures.data()));
         abandonedTextures.clear();
@@ -586,6 +619,9 @@ void Context::performCleanup() {
     }
 
     if (!abandonedRenderbuffers.empty()) {
+        for (const auto id : abandonedRenderbuffers) {
+            untrack(renderbufferSizes, memoryStats.renderbuffers, id);
+        }
         MBGL_CHECK_ERROR(glDeleteRenderbuffers(int(abandonedRenderbuffers.size()),
                                                abandonedRenderbuffers.data()));
         abandonedRenderbuffers.clear();
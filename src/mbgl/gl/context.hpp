@@ -32,6 +32,21 @@ namespace gl {
 
 constexpr size_t TextureMax = 64;
 
+// The GPU memory taken up by the objects that a context created, in bytes. Objects count until
+// they are deleted in `Context::performCleanup`. Released textures that have storage are deleted
+// rather than pooled, so the pool never holds memory.
+class MemoryStats {
+public:
+    std::size_t vertexBuffers = 0;
+    std::size_t indexBuffers = 0;
+    std::size_t textures = 0;
+    std::size_t renderbuffers = 0;
+
+    std::size_t total() const {
+        return vertexBuffers + indexBuffers + textures + renderbuffers;
+    }
+};
+
 class Context : private util::noncopyable {
 public:
     ~Context();
@@ -158,6 +173,10 @@ public:
 
     void setDirtyState();
 
+    const MemoryStats& getMemoryStats() const {
+        return memoryStats;
+    }
+
     State<value::ActiveTexture> activeTexture;
     State<value::BindFramebuffer> bindFramebuffer;
     State<value::Viewport> viewport;
@@ -233,6 +252,13 @@ private:
     std::vector<VertexArrayID> abandonedVertexArrays;
     std::vector<FramebufferID> abandonedFramebuffers;
     std::vector<RenderbufferID> abandonedRenderbuffers;
+
+    // The size of every object that counts towards the memory stats.
+    std::unordered_map<BufferID, std::size_t> vertexBufferSizes;
+    std::unordered_map<BufferID, std::size_t> indexBufferSizes;
+    std::unordered_map<TextureID, std::size_t> textureSizes;
+    std::unordered_map<RenderbufferID, std::size_t> renderbufferSizes;
+    MemoryStats memoryStats;
 };
 
 } // namespace gl
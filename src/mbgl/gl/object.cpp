@@ -24,7 +24,9 @@ void BufferDeleter::operator()(BufferID id) const {
 
 void TextureDeleter::operator()(TextureID id) const {
     assert(context);
-    if (context->pooledTextures.size() >= TextureMax) {
+    // Textures that were given storage are deleted, so that their memory is freed; only
+    // textures that never were go back to the pool.
+    if (context->pooledTextures.size() >= TextureMax || context->textureSizes.count(id)) {
         context->abandonedTextures.push_back(id);
     } else {
         context->pooledTextures.push_back(id);
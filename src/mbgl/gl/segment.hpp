@@ -3,6 +3,7 @@
 #include <mbgl/util/optional.hpp>
 
 #include <cstddef>
+#include <vector>
 
 namespace mbgl {
 namespace gl {
@@ -26,6 +27,7 @@ public:
 
 private:
     friend class Context;
+    template <class> friend class SegmentVector;
     mutable optional<UniqueVertexArray> vao;
 };
 
@@ -33,6 +35,14 @@ template <class Attributes>
 class SegmentVector : public std::vector<Segment> {
 public:
     SegmentVector() = default;
+
+    // Vertex array objects refer to the buffers that the segments were drawn from, and have to
+    // go along with them.
+    void resetVertexArrays() {
+        for (auto& segment : *this) {
+            segment.vao = {};
+        }
+    }
 };
 
 } // namespace gl
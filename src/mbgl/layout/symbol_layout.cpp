@@ -2,7 +2,7 @@
 #include <mbgl/layout/merge_lines.hpp>
 #include <mbgl/layout/clip_lines.hpp>
 #include <mbgl/renderer/symbol_bucket.hpp>
-#include <mbgl/style/filter_evaluator.hpp>
+#include <mbgl/style/compiled_filter.hpp>
 #include <mbgl/sprite/sprite_atlas.hpp>
 #include <mbgl/text/glyph_atlas.hpp>
 #include <mbgl/text/get_anchors.hpp>
@@ -35,7 +35,8 @@ SymbolLayout::SymbolLayout(std::string bucketName_,
                            const style::Filter& filter,
                            style::SymbolLayoutProperties::Evaluated layout_,
                            float textMaxSize_,
-                           SpriteAtlas& spriteAtlas_)
+                           SpriteAtlas& spriteAtlas_,
+                           const std::atomic<bool>& obsolete_)
     : bucketName(std::move(bucketName_)),
       sourceLayerName(std::move(sourceLayerName_)),
       overscaling(overscaling_),
@@ -44,6 +45,7 @@ SymbolLayout::SymbolLayout(std::string bucketName_,
       layout(std::move(layout_)),
       textMaxSize(textMaxSize_),
       spriteAtlas(spriteAtlas_),
+      obsolete(obsolete_),
       tileSize(util::tileSize * overscaling_),
       tilePixelRatio(float(util::EXTENT) / tileSize) {
 
@@ -57,17 +59,19 @@ SymbolLayout::SymbolLayout(std::string bucketName_,
     auto layerName = layer.getName();
 
     // Determine and load glyph ranges
-    const size_t featureCount = layer.featureCount();
-    for (size_t i = 0; i < featureCount; ++i) {
-        auto feature = layer.getFeature(i);
-        if (!filter(feature->getType(), feature->getID(), [&] (const auto& key) { return feature->getValue(key); }))
-            continue;
+    CompiledFilter compiledFilter(filter, layer);
+    layer.eachFeature([&] (const GeometryTileFeature& feature, std::size_t i) {
+        if (obsolete) {
+            return false;
+        }
+        if (!compiledFilter(feature))
+            return true;
 
         SymbolFeature ft;
         ft.index = i;
 
         auto getValue = [&feature](const std::string& key) -> std::string {
-            auto value = feature->getValue(key);
+            auto value = feature.getValue(key);
             if (!value)
                 return std::string();
             if (value->is<std::string>())
@@ -105,11 +109,13 @@ SymbolLayout::SymbolLayout(std::string bucketName_,
         }
 
         if (ft.text || ft.icon) {
-            ft.type = feature->getType();
-            ft.geometry = feature->getGeometries();
+            ft.type = feature.getType();
+            ft.geometry = feature.getGeometries();
             features.push_back(std::move(ft));
         }
-    }
+
+        return true;
+    });
 
     if (layout.get<SymbolPlacement>() == SymbolPlacementType::Line) {
         util::mergeLines(features);
@@ -178,6 +184,10 @@ void SymbolLayout::prepare(uintptr_t tileUID,
     auto glyphSet = glyphAtlas.getGlyphSet(layout.get<TextFont>());
 
     for (const auto& feature : features) {
+        if (obsolete) {
+            return;
+        }
+
         if (feature.geometry.empty()) continue;
 
         Shaping shapedText;
@@ -382,6 +392,9 @@ std::unique_ptr<SymbolBucket> SymbolLayout::place(CollisionTile& collisionTile)
     }
 
     for (SymbolInstance &symbolInstance : symbolInstances) {
+        if (obsolete) {
+            return bucket;
+        }
 
         const bool hasText = symbolInstance.hasText;
         const bool hasIcon = symbolInstance.hasIcon;
@@ -6,6 +6,7 @@
 #include <mbgl/layout/symbol_instance.hpp>
 #include <mbgl/text/bidi.hpp>
 
+#include <atomic>
 #include <memory>
 #include <map>
 #include <unordered_set>
@@ -36,7 +37,11 @@ public:
                  const style::Filter&,
                  style::SymbolLayoutProperties::Evaluated,
                  float textMaxSize,
-                 SpriteAtlas&);
+                 SpriteAtlas&,
+                 const std::atomic<bool>& obsolete);
+
+    // The constructor, `prepare()` and `place()` give up early once `obsolete` is set. The
+    // layout must not be used after that.
 
     bool canPrepare(GlyphAtlas&);
 
@@ -81,6 +86,7 @@ private:
     const float textMaxSize;
 
     SpriteAtlas& spriteAtlas;
+    const std::atomic<bool>& obsolete;
 
     const uint32_t tileSize;
     const float tilePixelRatio;
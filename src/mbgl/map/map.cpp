@@ -13,16 +13,19 @@
 #include <mbgl/style/update_parameters.hpp>
 #include <mbgl/style/query_parameters.hpp>
 #include <mbgl/renderer/painter.hpp>
+#include <mbgl/gl/context.hpp>
 #include <mbgl/storage/file_source.hpp>
 #include <mbgl/storage/resource.hpp>
 #include <mbgl/storage/response.hpp>
 #include <mbgl/util/projection.hpp>
 #include <mbgl/util/math.hpp>
 #include <mbgl/util/exception.hpp>
+#include <mbgl/util/constants.hpp>
 #include <mbgl/util/async_task.hpp>
 #include <mbgl/util/mapbox.hpp>
 #include <mbgl/util/tile_coordinate.hpp>
 #include <mbgl/actor/scheduler.hpp>
+#include <mbgl/actor/scheduler_statistics.hpp>
 #include <mbgl/util/logging.hpp>
 #include <mbgl/math/log2.hpp>
 
@@ -97,7 +100,10 @@ public:
     std::unique_ptr<AsyncRequest> styleRequest;
 
     std::unique_ptr<StillImageRequest> stillImageRequest;
-    size_t sourceCacheSize;
+    optional<size_t> sourceCacheSize;
+    size_t tileCacheBytes = util::DEFAULT_TILE_CACHE_BYTES;
+    size_t gpuMemoryBudget = util::DEFAULT_GPU_MEMORY_BUDGET;
+    size_t parallelLayoutThreshold = util::DEFAULT_PARALLEL_LAYOUT_THRESHOLD;
     TimePoint timePoint;
     bool loading = false;
 };
@@ -273,6 +279,7 @@ void Map::Impl::update() {
                                        mode,
                                        *annotationManager,
                                        *style);
+    parameters.parallelLayoutThreshold = parallelLayoutThreshold;
 
     style->updateTiles(parameters);
 
@@ -310,6 +317,11 @@ void Map::Impl::render(View& view) {
 
     painter->cleanup();
 
+    const std::size_t gpuBytes = backend.getContext().getMemoryStats().total();
+    if (gpuBytes > gpuMemoryBudget && style->releaseCachedGPUResources(gpuBytes - gpuMemoryBudget)) {
+        painter->cleanup();
+    }
+
     if (style->hasTransitions()) {
         updateFlags |= Update::RecalculateStyle;
         asyncUpdate.send();
@@ -360,7 +372,7 @@ void Map::setStyleURL(const std::string& url) {
         } else if (res.notModified || res.noContent) {
             return;
         } else {
-            impl->loadStyleJSON(*res.data);
+            impl->loadStyleJSON(res.data.string());
         }
     });
 }
@@ -385,6 +397,10 @@ void Map::setStyleJSON(const std::string& json) {
 
 void Map::Impl::loadStyleJSON(const std::string& json) {
     style->setObserver(this);
+    if (sourceCacheSize) {
+        style->setSourceTileCacheSize(*sourceCacheSize);
+    }
+    style->setTileCacheBytes(tileCacheBytes);
     style->setJSON(json);
     styleJSON = json;
 
@@ -1058,13 +1074,64 @@ void Map::setSourceTileCacheSize(size_t size) {
     }
 }
 
+std::unordered_map<std::string, SourceMemoryUsage> Map::getSourceMemoryUsage() const {
+    if (!impl->style) {
+        return {};
+    }
+    return impl->style->getSourceMemoryUsage();
+}
+
+void Map::setTileCacheBytes(size_t bytes) {
+    if (bytes != impl->tileCacheBytes) {
+        impl->tileCacheBytes = bytes;
+        if (!impl->style) return;
+        impl->style->setTileCacheBytes(bytes);
+        impl->backend.invalidate();
+    }
+}
+
+void Map::setGPUMemoryBudget(size_t bytes) {
+    if (bytes != impl->gpuMemoryBudget) {
+        impl->gpuMemoryBudget = bytes;
+        impl->backend.invalidate();
+    }
+}
+
+size_t Map::getGPUMemoryBudget() const {
+    return impl->gpuMemoryBudget;
+}
+
+void Map::setParallelLayoutThreshold(size_t threshold) {
+    impl->parallelLayoutThreshold = threshold;
+}
+
+size_t Map::getParallelLayoutThreshold() const {
+    return impl->parallelLayoutThreshold;
+}
+
 void Map::onLowMemory() {
+    onMemoryPressure(MemoryPressure::Critical);
+}
+
+void Map::onMemoryPressure(MemoryPressure pressure) {
+    if (impl->style) {
+        impl->style->onMemoryPressure(pressure);
+    }
+    if (pressure == MemoryPressure::Background) {
+        impl->annotationManager->getSpriteAtlas().releaseTexture();
+    }
+
+    // Deletes the GPU resources that were just released right away, rather than at the next
+    // frame.
     if (impl->painter) {
         BackendScope guard(impl->backend);
         impl->painter->cleanup();
     }
-    if (impl->style) {
-        impl->style->onLowMemory();
+
+    impl->fileSource.onMemoryPressure(pressure);
+
+    // Rendering would upload everything again.
+    if (impl->style && pressure != MemoryPressure::Background) {
         impl->backend.invalidate();
     }
 }
@@ -1104,4 +1171,30 @@ void Map::dumpDebugLogs() const {
     Log::Info(Event::General, "--------------------------------------------------------------------------------");
 }
 
+void Map::enableSchedulerStatistics(size_t sampleInterval) {
+    if (SchedulerStatistics* statistics = impl->scheduler.getStatistics()) {
+        statistics->enable(sampleInterval);
+    }
+}
+
+void Map::disableSchedulerStatistics() {
+    if (SchedulerStatistics* statistics = impl->scheduler.getStatistics()) {
+        statistics->disable();
+    }
+}
+
+std::string Map::getSchedulerStatistics() const {
+    if (SchedulerStatistics* statistics = impl->scheduler.getStatistics()) {
+        return statistics->toJSON();
+    }
+    return {};
+}
+
+LayoutStatistics Map::getLayoutStatistics() const {
+    if (!impl->style) {
+        return {};
+    }
+    return impl->style->getLayoutStatistics();
+}
+
 } // namespace mbgl
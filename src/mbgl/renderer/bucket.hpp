@@ -1,6 +1,7 @@
 #pragma once
 
 #include <mbgl/renderer/render_pass.hpp>
+#include <mbgl/util/memory_usage.hpp>
 #include <mbgl/util/noncopyable.hpp>
 
 #include <atomic>
@@ -35,6 +36,14 @@ public:
 
     virtual bool hasData() const = 0;
 
+    // The memory taken up by the bucket's vertex, index and image data. It stays on the CPU
+    // after upload, so uploaded data counts twice.
+    virtual MemoryUsage getMemoryUsage() const { return {}; }
+
+    // Frees the GPU copy of the bucket's data. The data is uploaded again before the bucket
+    // is next rendered.
+    virtual void releaseGPUResources() = 0;
+
     bool needsUpload() const {
         return !uploaded;
     }
@@ -2,7 +2,7 @@
 
 #include <mbgl/renderer/bucket.hpp>
 #include <mbgl/map/mode.hpp>
-#include <mbgl/tile/geometry_tile_data.hpp>
+#include <mbgl/tile/flat_geometry.hpp>
 #include <mbgl/gl/vertex_buffer.hpp>
 #include <mbgl/gl/index_buffer.hpp>
 #include <mbgl/gl/segment.hpp>
@@ -18,7 +18,9 @@ public:
     void render(Painter&, PaintParameters&, const style::Layer&, const RenderTile&) override;
 
     bool hasData() const override;
-    void addGeometry(const GeometryCollection&);
+    MemoryUsage getMemoryUsage() const override;
+    void releaseGPUResources() override;
+    void addGeometry(const FlatGeometry&);
 
     gl::VertexVector<CircleVertex> vertices;
     gl::IndexVector<gl::Triangles> triangles;
@@ -26,8 +26,18 @@ using namespace style;
 
 struct GeometryTooLongException : std::exception {};
 
-void FillBucket::addGeometry(const GeometryCollection& geometry) {
-    for (auto& polygon : classifyRings(geometry)) {
+void FillBucket::addGeometry(GeometryBuffers& buffers, const std::atomic<bool>& obsolete) {
+    RingPolygons& polygons = buffers.polygons;
+    std::vector<GeometryRing>& polygon = buffers.polygon;
+    polygons.classify(buffers.geometry);
+
+    for (std::size_t p = 0; p < polygons.polygonCount(); ++p) {
+        if (obsolete) {
+            return;
+        }
+
+        polygons.getPolygon(p, polygon);
+
         // Optimize polygons with many interior rings for earcut tesselation.
         limitHoles(polygon, 500);
 
@@ -111,4 +121,18 @@ bool FillBucket::hasData() const {
     return !triangleSegments.empty() || !lineSegments.empty();
 }
 
+MemoryUsage FillBucket::getMemoryUsage() const {
+    const std::size_t bytes = vertices.byteSize() + lines.byteSize() + triangles.byteSize();
+    return { bytes, uploaded ? bytes : 0 };
+}
+
+void FillBucket::releaseGPUResources() {
+    lineSegments.resetVertexArrays();
+    triangleSegments.resetVertexArrays();
+    vertexBuffer = {};
+    lineIndexBuffer = {};
+    triangleIndexBuffer = {};
+    uploaded = false;
+}
+
 } // namespace mbgl
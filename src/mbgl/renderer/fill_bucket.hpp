@@ -1,12 +1,13 @@
 #pragma once
 
 #include <mbgl/renderer/bucket.hpp>
-#include <mbgl/tile/geometry_tile_data.hpp>
+#include <mbgl/tile/flat_geometry.hpp>
 #include <mbgl/gl/vertex_buffer.hpp>
 #include <mbgl/gl/index_buffer.hpp>
 #include <mbgl/gl/segment.hpp>
 #include <mbgl/programs/fill_program.hpp>
 
+#include <atomic>
 #include <vector>
 
 namespace mbgl {
@@ -16,8 +17,12 @@ public:
     void upload(gl::Context&) override;
     void render(Painter&, PaintParameters&, const style::Layer&, const RenderTile&) override;
     bool hasData() const override;
+    MemoryUsage getMemoryUsage() const override;
+    void releaseGPUResources() override;
 
-    void addGeometry(const GeometryCollection&);
+    // Adds the geometry in `buffers`, using their other buffers as scratch space. Stops adding
+    // polygons of a multi-polygon once `obsolete` is set.
+    void addGeometry(GeometryBuffers& buffers, const std::atomic<bool>& obsolete);
 
     gl::VertexVector<FillVertex> vertices;
     gl::IndexVector<gl::Lines> lines;
@@ -17,9 +17,12 @@ LineBucket::~LineBucket() {
     // Do not remove. header file only contains forward definitions to unique pointers.
 }
 
-void LineBucket::addGeometry(const GeometryCollection& geometryCollection) {
-    for (auto& line : geometryCollection) {
-        addGeometry(line);
+void LineBucket::addGeometry(const FlatGeometry& geometry, const std::atomic<bool>& obsolete) {
+    for (std::size_t i = 0; i < geometry.ringCount(); ++i) {
+        if (obsolete) {
+            return;
+        }
+        addGeometry(geometry.ring(i));
     }
 }
 
@@ -49,7 +52,7 @@ const float LINE_DISTANCE_SCALE = 1.0 / 2.0;
 // The maximum line distance, in tile units, that fits in the buffer.
 const float MAX_LINE_DISTANCE = std::pow(2, LINE_DISTANCE_BUFFER_BITS) / LINE_DISTANCE_SCALE;
 
-void LineBucket::addGeometry(const GeometryCoordinates& coordinates) {
+void LineBucket::addGeometry(const GeometryRing& coordinates) {
     const std::size_t len = [&coordinates] {
         std::size_t l = coordinates.size();
         // If the line has duplicate vertices at the end, adjust length to remove them.
@@ -443,4 +446,16 @@ bool LineBucket::hasData() const {
     return !segments.empty();
 }
 
+MemoryUsage LineBucket::getMemoryUsage() const {
+    const std::size_t bytes = vertices.byteSize() + triangles.byteSize();
+    return { bytes, uploaded ? bytes : 0 };
+}
+
+void LineBucket::releaseGPUResources() {
+    segments.resetVertexArrays();
+    vertexBuffer = {};
+    indexBuffer = {};
+    uploaded = false;
+}
+
 } // namespace mbgl
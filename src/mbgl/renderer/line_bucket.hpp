@@ -1,13 +1,14 @@
 #pragma once
 
 #include <mbgl/renderer/bucket.hpp>
-#include <mbgl/tile/geometry_tile_data.hpp>
+#include <mbgl/tile/flat_geometry.hpp>
 #include <mbgl/gl/vertex_buffer.hpp>
 #include <mbgl/gl/index_buffer.hpp>
 #include <mbgl/gl/segment.hpp>
 #include <mbgl/programs/line_program.hpp>
 #include <mbgl/style/layers/line_layer_properties.hpp>
 
+#include <atomic>
 #include <vector>
 
 namespace mbgl {
@@ -20,9 +21,12 @@ public:
     void upload(gl::Context&) override;
     void render(Painter&, PaintParameters&, const style::Layer&, const RenderTile&) override;
     bool hasData() const override;
+    MemoryUsage getMemoryUsage() const override;
+    void releaseGPUResources() override;
 
-    void addGeometry(const GeometryCollection&);
-    void addGeometry(const GeometryCoordinates& line);
+    // Stops adding lines of a multi-line once `obsolete` is set.
+    void addGeometry(const FlatGeometry&, const std::atomic<bool>& obsolete);
+    void addGeometry(const GeometryRing& line);
 
     style::LineLayoutProperties::Evaluated layout;
 
@@ -27,4 +27,14 @@ bool RasterBucket::hasData() const {
     return true;
 }
 
+MemoryUsage RasterBucket::getMemoryUsage() const {
+    // Textures are uploaded as RGBA.
+    return { image.bytes(), texture ? std::size_t(texture->size.width) * texture->size.height * 4 : 0 };
+}
+
+void RasterBucket::releaseGPUResources() {
+    texture = {};
+    uploaded = false;
+}
+
 } // namespace mbgl
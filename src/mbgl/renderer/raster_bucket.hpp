@@ -14,6 +14,8 @@ public:
     void upload(gl::Context&) override;
     void render(Painter&, PaintParameters&, const style::Layer&, const RenderTile&) override;
     bool hasData() const override;
+    MemoryUsage getMemoryUsage() const override;
+    void releaseGPUResources() override;
 
     UnassociatedImage image;
     optional<gl::Texture> texture;
@@ -47,6 +47,30 @@ bool SymbolBucket::hasData() const {
     return false;
 }
 
+MemoryUsage SymbolBucket::getMemoryUsage() const {
+    const std::size_t bytes =
+        text.vertices.byteSize() + text.triangles.byteSize() +
+        icon.vertices.byteSize() + icon.triangles.byteSize() +
+        collisionBox.vertices.byteSize() + collisionBox.lines.byteSize();
+    return { bytes, uploaded ? bytes : 0 };
+}
+
+void SymbolBucket::releaseGPUResources() {
+    text.segments.resetVertexArrays();
+    text.vertexBuffer = {};
+    text.indexBuffer = {};
+
+    icon.segments.resetVertexArrays();
+    icon.vertexBuffer = {};
+    icon.indexBuffer = {};
+
+    collisionBox.segments.resetVertexArrays();
+    collisionBox.vertexBuffer = {};
+    collisionBox.indexBuffer = {};
+
+    uploaded = false;
+}
+
 bool SymbolBucket::hasTextData() const {
     return !text.segments.empty();
 }
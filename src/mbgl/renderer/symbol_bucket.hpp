@@ -24,6 +24,8 @@ public:
     void upload(gl::Context&) override;
     void render(Painter&, PaintParameters&, const style::Layer&, const RenderTile&) override;
     bool hasData() const override;
+    MemoryUsage getMemoryUsage() const override;
+    void releaseGPUResources() override;
     bool hasTextData() const;
     bool hasIconData() const;
     bool hasCollisionBoxData() const;
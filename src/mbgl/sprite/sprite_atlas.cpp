@@ -21,8 +21,8 @@ namespace mbgl {
 static SpriteAtlasObserver nullObserver;
 
 struct SpriteAtlas::Loader {
-    std::shared_ptr<const std::string> image;
-    std::shared_ptr<const std::string> json;
+    ByteBuffer image;
+    ByteBuffer json;
     std::unique_ptr<AsyncRequest> jsonRequest;
     std::unique_ptr<AsyncRequest> spriteRequest;
 };
@@ -52,7 +52,7 @@ void SpriteAtlas::load(const std::string& url, FileSource& fileSource) {
         } else if (res.notModified) {
             return;
         } else if (res.noContent) {
-            loader->json = std::make_shared<const std::string>();
+            loader->json = ByteBuffer(std::string());
             emitSpriteLoadedIfComplete();
         } else {
             // Only trigger a sprite loaded event we got new data.
@@ -67,7 +67,7 @@ void SpriteAtlas::load(const std::string& url, FileSource& fileSource) {
         } else if (res.notModified) {
             return;
         } else if (res.noContent) {
-            loader->image = std::make_shared<const std::string>();
+            loader->image = ByteBuffer(std::string());
             emitSpriteLoadedIfComplete();
         } else {
             loader->image = res.data;
@@ -83,7 +83,7 @@ void SpriteAtlas::emitSpriteLoadedIfComplete() {
         return;
     }
 
-    auto result = parseSprite(*loader->image, *loader->json);
+    auto result = parseSprite(loader->image, loader->json);
     if (result.is<Sprites>()) {
         loaded = true;
         setSprites(result.get<Sprites>());
@@ -327,6 +327,10 @@ void SpriteAtlas::upload(gl::Context& context, gl::TextureUnit unit) {
     dirty = false;
 }
 
+void SpriteAtlas::releaseTexture() {
+    texture = {};
+}
+
 void SpriteAtlas::bind(bool linear, gl::Context& context, gl::TextureUnit unit) {
     upload(context, unit);
     context.bindTexture(*texture, unit,
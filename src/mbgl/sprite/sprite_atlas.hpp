@@ -92,6 +92,9 @@ public:
     // the texture is only bound when the data is out of date (=dirty).
     void upload(gl::Context&, gl::TextureUnit unit);
 
+    // Frees the texture. It is uploaded again when the atlas is next bound.
+    void releaseTexture();
+
     Size getSize() const { return size; }
     float getPixelRatio() const { return pixelRatio; }
 
@@ -93,18 +93,18 @@ bool getBoolean(const JSValue& value, const char* name, const bool def = false)
 
 } // namespace
 
-SpriteParseResult parseSprite(const std::string& image, const std::string& json) {
+SpriteParseResult parseSprite(const ByteBuffer& image, const ByteBuffer& json) {
     Sprites sprites;
     PremultipliedImage raster;
 
     try {
-        raster = decodeImage(image);
+        raster = decodeImage(image.data(), image.size());
     } catch (...) {
         return std::current_exception();
     }
 
     JSDocument doc;
-    doc.Parse<0>(json.c_str());
+    doc.Parse<0>(json.data(), json.size());
 
     if (doc.HasParseError()) {
         std::stringstream message;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <mbgl/util/byte_buffer.hpp>
 #include <mbgl/util/image.hpp>
 #include <mbgl/util/noncopyable.hpp>
 #include <mbgl/util/variant.hpp>
@@ -32,6 +33,6 @@ using SpriteParseResult = variant<
     std::exception_ptr>; // error
 
 // Parses an image and an associated JSON file and returns the sprite objects.
-SpriteParseResult parseSprite(const std::string& image, const std::string& json);
+SpriteParseResult parseSprite(const ByteBuffer& image, const ByteBuffer& json);
 
 } // namespace mbgl
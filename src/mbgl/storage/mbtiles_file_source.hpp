@@ -0,0 +1,36 @@
+#pragma once
+
+#include <mbgl/storage/file_source.hpp>
+
+namespace mbgl {
+
+namespace util {
+template <typename T> class Thread;
+} // namespace util
+
+/*
+    Serves tiles straight from MBTiles packages, which are opened read-only.
+
+    `mbtiles:///path/to/file.mbtiles` yields a TileJSON document built from the package's
+    metadata table, whose tile URL template is `mbtiles:///path/to/file.mbtiles/{z}/{x}/{y}`.
+    Tile URLs are in the XYZ scheme; the y coordinate is flipped to the TMS rows that MBTiles
+    stores. Tile blobs are passed through exactly as stored, which for vector tiles usually
+    means gzip compressed.
+*/
+class MBTilesFileSource : public FileSource {
+public:
+    MBTilesFileSource();
+    ~MBTilesFileSource() override;
+
+    std::unique_ptr<AsyncRequest> request(const Resource&, Callback) override;
+    // Closes the packages under critical pressure; they are reopened on the next request.
+    void onMemoryPressure(MemoryPressure) override;
+
+    static bool acceptsURL(const std::string& url);
+
+private:
+    class Impl;
+    std::unique_ptr<util::Thread<Impl>> thread;
+};
+
+} // namespace mbgl
@@ -1,5 +1,5 @@
 #include <mbgl/style/bucket_parameters.hpp>
-#include <mbgl/style/filter_evaluator.hpp>
+#include <mbgl/style/compiled_filter.hpp>
 #include <mbgl/tile/geometry_tile_data.hpp>
 
 namespace mbgl {
@@ -9,12 +9,16 @@ void BucketParameters::eachFilteredFeature(const Filter& filter,
                                            const GeometryTileLayer& layer,
                                            std::function<void (const GeometryTileFeature&, std::size_t index, const std::string& layerName)> function) {
     auto name = layer.getName();
-    for (std::size_t i = 0; !cancelled() && i < layer.featureCount(); i++) {
-        auto feature = layer.getFeature(i);
-        if (!filter(feature->getType(), feature->getID(), [&] (const auto& key) { return feature->getValue(key); }))
-            continue;
-        function(*feature, i, name);
-    }
+    CompiledFilter compiledFilter(filter, layer);
+    layer.eachFeature([&] (const GeometryTileFeature& feature, std::size_t i) {
+        if (cancelled()) {
+            return false;
+        }
+        if (compiledFilter(feature)) {
+            function(feature, i, name);
+        }
+        return true;
+    });
 }
 
 } // namespace style
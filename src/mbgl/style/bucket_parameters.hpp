@@ -12,6 +12,7 @@ namespace mbgl {
 class GeometryTileLayer;
 class GeometryTileFeature;
 class FeatureIndex;
+class GeometryBuffers;
 
 namespace style {
 
@@ -22,6 +23,10 @@ public:
     FeatureIndex& featureIndex;
     const MapMode mode;
 
+    // Scratch space that buckets read feature geometry into. It belongs to the layout, which
+    // reuses it across the buckets that it builds one after another.
+    GeometryBuffers& buffers;
+
     bool cancelled() const {
         return obsolete;
     }
@@ -0,0 +1,215 @@
+#include <mbgl/style/compiled_filter.hpp>
+#include <mbgl/style/filter_evaluator.hpp>
+
+#include <algorithm>
+
+namespace mbgl {
+namespace style {
+
+constexpr int32_t CompiledFilter::typeKey;
+constexpr int32_t CompiledFilter::idKey;
+
+class CompiledFilter::Compiler {
+public:
+    CompiledFilter& compiled;
+    std::vector<std::string>& names;
+
+    Node operator()(const NullFilter&) const {
+        return { Op::True, 0, nullptr, nullptr, {} };
+    }
+
+    Node operator()(const EqualsFilter& filter) const {
+        return { Op::Equals, key(filter.key), &filter.value, nullptr, {} };
+    }
+
+    Node operator()(const NotEqualsFilter& filter) const {
+        return { Op::NotEquals, key(filter.key), &filter.value, nullptr, {} };
+    }
+
+    Node operator()(const LessThanFilter& filter) const {
+        return { Op::LessThan, key(filter.key), &filter.value, nullptr, {} };
+    }
+
+    Node operator()(const LessThanEqualsFilter& filter) const {
+        return { Op::LessThanEquals, key(filter.key), &filter.value, nullptr, {} };
+    }
+
+    Node operator()(const GreaterThanFilter& filter) const {
+        return { Op::GreaterThan, key(filter.key), &filter.value, nullptr, {} };
+    }
+
+    Node operator()(const GreaterThanEqualsFilter& filter) const {
+        return { Op::GreaterThanEquals, key(filter.key), &filter.value, nullptr, {} };
+    }
+
+    Node operator()(const InFilter& filter) const {
+        return { Op::In, key(filter.key), nullptr, &filter.values, {} };
+    }
+
+    Node operator()(const NotInFilter& filter) const {
+        return { Op::NotIn, key(filter.key), nullptr, &filter.values, {} };
+    }
+
+    Node operator()(const AnyFilter& filter) const {
+        return { Op::Any, 0, nullptr, nullptr, children(filter.filters) };
+    }
+
+    Node operator()(const AllFilter& filter) const {
+        return { Op::All, 0, nullptr, nullptr, children(filter.filters) };
+    }
+
+    Node operator()(const NoneFilter& filter) const {
+        return { Op::None, 0, nullptr, nullptr, children(filter.filters) };
+    }
+
+    Node operator()(const HasFilter& filter) const {
+        return { Op::Has, key(filter.key), nullptr, nullptr, {} };
+    }
+
+    Node operator()(const NotHasFilter& filter) const {
+        return { Op::NotHas, key(filter.key), nullptr, nullptr, {} };
+    }
+
+private:
+    int32_t key(const std::string& name) const {
+        if (name == "$type") {
+            compiled.usesType = true;
+            return typeKey;
+        }
+        if (name == "$id") {
+            compiled.usesID = true;
+            return idKey;
+        }
+        auto it = std::find(names.begin(), names.end(), name);
+        if (it == names.end()) {
+            it = names.insert(names.end(), name);
+        }
+        return static_cast<int32_t>(it - names.begin());
+    }
+
+    std::vector<Node> children(const std::vector<Filter>& filters) const {
+        std::vector<Node> result;
+        result.reserve(filters.size());
+        for (const auto& filter : filters) {
+            result.push_back(Filter::visit(filter, *this));
+        }
+        return result;
+    }
+};
+
+CompiledFilter::CompiledFilter(const Filter& filter, const GeometryTileLayer& layer) {
+    std::vector<std::string> names;
+    root = Filter::visit(filter, Compiler { *this, names });
+    keys = layer.resolveKeys(std::move(names));
+}
+
+bool CompiledFilter::operator()(const GeometryTileFeature& feature) const {
+    if (root.op == Op::True) {
+        return true;
+    }
+
+    if (!keys.names.empty()) {
+        feature.getValues(keys, values);
+    }
+    if (usesType) {
+        type = Value(uint64_t(feature.getType()));
+    }
+    if (usesID) {
+        auto identifier = feature.getID();
+        if (identifier) {
+            id = FeatureIdentifier::visit(*identifier, [] (auto value) {
+                return Value(std::move(value));
+            });
+        } else {
+            id = {};
+        }
+    }
+
+    return evaluate(root);
+}
+
+const optional<Value>& CompiledFilter::get(int32_t key) const {
+    switch (key) {
+    case typeKey:
+        return type;
+    case idKey:
+        return id;
+    default:
+        return values[key];
+    }
+}
+
+bool CompiledFilter::evaluate(const Node& node) const {
+    switch (node.op) {
+    case Op::True:
+        return true;
+
+    case Op::Equals: {
+        const auto& actual = get(node.key);
+        return actual && detail::equal(*actual, *node.value);
+    }
+
+    case Op::NotEquals: {
+        const auto& actual = get(node.key);
+        return !actual || !detail::equal(*actual, *node.value);
+    }
+
+    case Op::LessThan: {
+        const auto& actual = get(node.key);
+        return actual && detail::compare(*actual, *node.value, [] (const auto& lhs, const auto& rhs) { return lhs < rhs; });
+    }
+
+    case Op::LessThanEquals: {
+        const auto& actual = get(node.key);
+        return actual && detail::compare(*actual, *node.value, [] (const auto& lhs, const auto& rhs) { return lhs <= rhs; });
+    }
+
+    case Op::GreaterThan: {
+        const auto& actual = get(node.key);
+        return actual && detail::compare(*actual, *node.value, [] (const auto& lhs, const auto& rhs) { return lhs > rhs; });
+    }
+
+    case Op::GreaterThanEquals: {
+        const auto& actual = get(node.key);
+        return actual && detail::compare(*actual, *node.value, [] (const auto& lhs, const auto& rhs) { return lhs >= rhs; });
+    }
+
+    case Op::In:
+    case Op::NotIn: {
+        const auto& actual = get(node.key);
+        if (!actual) {
+            return node.op == Op::NotIn;
+        }
+        const bool found = std::any_of(node.values->begin(), node.values->end(), [&] (const Value& v) {
+            return detail::equal(*actual, v);
+        });
+        return found == (node.op == Op::In);
+    }
+
+    case Op::Has:
+        return bool(get(node.key));
+
+    case Op::NotHas:
+        return !get(node.key);
+
+    case Op::Any:
+        return std::any_of(node.children.begin(), node.children.end(), [&] (const Node& child) {
+            return evaluate(child);
+        });
+
+    case Op::All:
+        return std::all_of(node.children.begin(), node.children.end(), [&] (const Node& child) {
+            return evaluate(child);
+        });
+
+    case Op::None:
+        return std::none_of(node.children.begin(), node.children.end(), [&] (const Node& child) {
+            return evaluate(child);
+        });
+    }
+
+    return false;
+}
+
+} // namespace style
+} // namespace mbgl
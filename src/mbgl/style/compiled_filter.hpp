@@ -0,0 +1,84 @@
+#pragma once
+
+#include <mbgl/style/filter.hpp>
+#include <mbgl/tile/geometry_tile_data.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace mbgl {
+namespace style {
+
+/*
+    A `Filter` prepared for evaluating the features of a single `GeometryTileLayer`.
+
+    The filter is compiled into a tree of tagged operations. Each leaf refers to the value it
+    tests by position: the property keys that the filter refers to are collected and resolved
+    against the layer once, up front, and evaluating a feature reads all of those properties
+    in a single pass with `GeometryTileFeature::getValues`. No leaf looks up a key by name.
+
+    A `CompiledFilter` reuses a scratch buffer across evaluations, so it must not be used by
+    more than one thread at a time. It refers to the values of the filter, which must outlive
+    it.
+*/
+class CompiledFilter {
+public:
+    CompiledFilter(const Filter&, const GeometryTileLayer&);
+
+    bool operator()(const GeometryTileFeature&) const;
+
+private:
+    enum class Op : uint8_t {
+        True,
+        Equals,
+        NotEquals,
+        LessThan,
+        LessThanEquals,
+        GreaterThan,
+        GreaterThanEquals,
+        In,
+        NotIn,
+        Has,
+        NotHas,
+        Any,
+        All,
+        None,
+    };
+
+    // Leaves that test the feature itself rather than one of its properties.
+    static constexpr int32_t typeKey = -1;
+    static constexpr int32_t idKey = -2;
+
+    class Node {
+    public:
+        Op op;
+
+        // The position of the property in `values`, or `typeKey` or `idKey`.
+        int32_t key;
+
+        // The operand of comparisons, and of `In` and `NotIn`.
+        const Value* value;
+        const std::vector<Value>* values;
+
+        // The operands of `Any`, `All` and `None`.
+        std::vector<Node> children;
+    };
+
+    class Compiler;
+
+    bool evaluate(const Node&) const;
+    const optional<Value>& get(int32_t key) const;
+
+    Node root;
+    ResolvedKeys keys;
+    bool usesType = false;
+    bool usesID = false;
+
+    // The values of the feature that is being evaluated.
+    mutable std::vector<optional<Value>> values;
+    mutable optional<Value> type;
+    mutable optional<Value> id;
+};
+
+} // namespace style
+} // namespace mbgl
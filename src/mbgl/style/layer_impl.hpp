@@ -15,6 +15,7 @@
 namespace mbgl {
 
 class Bucket;
+class OverscaledTileID;
 
 namespace style {
 
@@ -61,6 +62,11 @@ public:
 
     virtual std::unique_ptr<Bucket> createBucket(BucketParameters&, const GeometryTileLayer&) const = 0;
 
+    // Whether a bucket created for one tile can be rendered as is for another tile with the
+    // same canonical tile ID, e.g. one overscaled further. Tile matrices already account for
+    // the difference in scale, so this holds unless the bucket depends on the zoom level.
+    virtual bool canShareBucket(const OverscaledTileID&, const OverscaledTileID&) const { return false; }
+
     // Checks whether this layer needs to be rendered in the given render pass.
     bool hasRenderPass(RenderPass) const;
 
@@ -10,6 +10,8 @@ public:
     virtual ~LayerObserver() = default;
 
     virtual void onLayerFilterChanged(Layer&) {}
+    virtual void onLayerSourceLayerChanged(Layer&) {}
+    virtual void onLayerZoomRangeChanged(Layer&) {}
     virtual void onLayerVisibilityChanged(Layer&) {}
     virtual void onLayerPaintPropertyChanged(Layer&) {}
     virtual void onLayerLayoutPropertyChanged(Layer&, const char *) {}
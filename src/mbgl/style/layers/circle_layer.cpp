@@ -40,6 +40,7 @@ const std::string& CircleLayer::getSourceID() const {
 
 void CircleLayer::setSourceLayer(const std::string& sourceLayer) {
     impl->sourceLayer = sourceLayer;
+    impl->observer->onLayerSourceLayerChanged(*this);
 }
 
 const std::string& CircleLayer::getSourceLayer() const {
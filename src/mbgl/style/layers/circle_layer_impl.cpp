@@ -25,15 +25,20 @@ std::unique_ptr<Bucket> CircleLayer::Impl::createBucket(BucketParameters& parame
     auto bucket = std::make_unique<CircleBucket>(parameters.mode);
 
     auto& name = bucketName();
+    FlatGeometry& geometry = parameters.buffers.geometry;
     parameters.eachFilteredFeature(filter, layer, [&] (const auto& feature, std::size_t index, const std::string& layerName) {
-        auto geometries = feature.getGeometries();
-        bucket->addGeometry(geometries);
-        parameters.featureIndex.insert(geometries, index, layerName, name);
+        feature.readGeometries(geometry);
+        bucket->addGeometry(geometry);
+        parameters.featureIndex.insert(geometry, index, layerName, name);
     });
 
     return std::move(bucket);
 }
 
+bool CircleLayer::Impl::canShareBucket(const OverscaledTileID&, const OverscaledTileID&) const {
+    return true;
+}
+
 float CircleLayer::Impl::getQueryRadius() const {
     const std::array<float, 2>& translate = paint.evaluated.get<CircleTranslate>();
     return paint.evaluated.get<CircleRadius>() + util::length(translate[0], translate[1]);
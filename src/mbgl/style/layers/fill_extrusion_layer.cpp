@@ -40,6 +40,7 @@ const std::string& FillExtrusionLayer::getSourceID() const {
 
 void FillExtrusionLayer::setSourceLayer(const std::string& sourceLayer) {
     impl->sourceLayer = sourceLayer;
+    impl->observer->onLayerSourceLayerChanged(*this);
 }
 
 const std::string& FillExtrusionLayer::getSourceLayer() const {
@@ -40,6 +40,7 @@ const std::string& FillLayer::getSourceID() const {
 
 void FillLayer::setSourceLayer(const std::string& sourceLayer) {
     impl->sourceLayer = sourceLayer;
+    impl->observer->onLayerSourceLayerChanged(*this);
 }
 
 const std::string& FillLayer::getSourceLayer() const {
@@ -34,15 +34,20 @@ std::unique_ptr<Bucket> FillLayer::Impl::createBucket(BucketParameters& paramete
     auto bucket = std::make_unique<FillBucket>();
 
     auto& name = bucketName();
+    FlatGeometry& geometry = parameters.buffers.geometry;
     parameters.eachFilteredFeature(filter, layer, [&] (const auto& feature, std::size_t index, const std::string& layerName) {
-        auto geometries = feature.getGeometries();
-        bucket->addGeometry(geometries);
-        parameters.featureIndex.insert(geometries, index, layerName, name);
+        feature.readGeometries(geometry);
+        bucket->addGeometry(parameters.buffers, parameters.obsolete);
+        parameters.featureIndex.insert(geometry, index, layerName, name);
     });
 
     return std::move(bucket);
 }
 
+bool FillLayer::Impl::canShareBucket(const OverscaledTileID&, const OverscaledTileID&) const {
+    return true;
+}
+
 float FillLayer::Impl::getQueryRadius() const {
     const std::array<float, 2>& translate = paint.evaluated.get<FillTranslate>();
     return util::length(translate[0], translate[1]);
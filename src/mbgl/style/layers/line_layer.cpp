@@ -40,6 +40,7 @@ const std::string& LineLayer::getSourceID() const {
 
 void LineLayer::setSourceLayer(const std::string& sourceLayer) {
     impl->sourceLayer = sourceLayer;
+    impl->observer->onLayerSourceLayerChanged(*this);
 }
 
 const std::string& LineLayer::getSourceLayer() const {
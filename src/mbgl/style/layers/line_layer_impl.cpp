@@ -32,15 +32,24 @@ std::unique_ptr<Bucket> LineLayer::Impl::createBucket(BucketParameters& paramete
     bucket->layout = layout.evaluate(PropertyEvaluationParameters(parameters.tileID.overscaledZ));
 
     auto& name = bucketName();
+    FlatGeometry& geometry = parameters.buffers.geometry;
     parameters.eachFilteredFeature(filter, layer, [&] (const auto& feature, std::size_t index, const std::string& layerName) {
-        auto geometries = feature.getGeometries();
-        bucket->addGeometry(geometries);
-        parameters.featureIndex.insert(geometries, index, layerName, name);
+        feature.readGeometries(geometry);
+        bucket->addGeometry(geometry, parameters.obsolete);
+        parameters.featureIndex.insert(geometry, index, layerName, name);
     });
 
     return std::move(bucket);
 }
 
+bool LineLayer::Impl::canShareBucket(const OverscaledTileID& a, const OverscaledTileID& b) const {
+    // Line joins depend on the layout properties, which may vary by zoom level. They also depend
+    // on the overscaling, but only in the placement of the extra vertex that precedes a sharp
+    // corner, which lies on the line either way.
+    return layout.evaluate(PropertyEvaluationParameters(a.overscaledZ)) ==
+           layout.evaluate(PropertyEvaluationParameters(b.overscaledZ));
+}
+
 float LineLayer::Impl::getLineWidth() const {
     if (paint.evaluated.get<LineGapWidth>() > 0) {
         return paint.evaluated.get<LineGapWidth>() + 2 * paint.evaluated.get<LineWidth>();
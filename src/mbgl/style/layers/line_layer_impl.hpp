@@ -16,6 +16,7 @@ public:
     bool evaluate(const PropertyEvaluationParameters&) override;
 
     std::unique_ptr<Bucket> createBucket(BucketParameters&, const GeometryTileLayer&) const override;
+    bool canShareBucket(const OverscaledTileID&, const OverscaledTileID&) const override;
 
     float getQueryRadius() const override;
     bool queryIntersectsGeometry(
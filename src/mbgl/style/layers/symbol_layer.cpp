@@ -40,6 +40,7 @@ const std::string& SymbolLayer::getSourceID() const {
 
 void SymbolLayer::setSourceLayer(const std::string& sourceLayer) {
     impl->sourceLayer = sourceLayer;
+    impl->observer->onLayerSourceLayerChanged(*this);
 }
 
 const std::string& SymbolLayer::getSourceLayer() const {
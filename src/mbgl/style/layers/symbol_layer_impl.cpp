@@ -68,7 +68,8 @@ std::unique_ptr<SymbolLayout> SymbolLayer::Impl::createLayout(BucketParameters&
                                           filter,
                                           evaluated,
                                           textMaxSize,
-                                          *spriteAtlas);
+                                          *spriteAtlas,
+                                          parameters.obsolete);
 }
 
 SymbolPropertyValues SymbolLayer::Impl::iconPropertyValues(const SymbolLayoutProperties::Evaluated& layout_) const {
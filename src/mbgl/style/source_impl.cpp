@@ -139,15 +139,6 @@ void Source::Impl::updateTiles(const UpdateParameters& parameters) {
     algorithm::updateRenderables(getTileFn, createTileFn, retainTileFn, renderTileFn,
                                  idealTiles, zoomRange, tileZoom);
 
-    if (type != SourceType::Annotations && cache.getSize() == 0) {
-        size_t conservativeCacheSize =
-            std::max((float)parameters.transformState.getSize().width / util::tileSize, 1.0f) *
-            std::max((float)parameters.transformState.getSize().height / util::tileSize, 1.0f) *
-            (parameters.transformState.getMaxZoom() - parameters.transformState.getMinZoom() + 1) *
-            0.5;
-        cache.setSize(conservativeCacheSize);
-    }
-
     removeStaleTiles(retain);
 
     const PlacementConfig config { parameters.transformState.getAngle(),
@@ -192,11 +183,11 @@ void Source::Impl::updateSymbolDependentTiles() {
     }
 }
 
-void Source::Impl::reloadTiles() {
-    cache.clear();
+void Source::Impl::reloadTiles(const std::unordered_set<std::string>& bucketNames) {
+    cache.invalidateBuckets(bucketNames);
 
     for (auto& pair : tiles) {
-        pair.second->redoLayout();
+        pair.second->redoLayout(bucketNames);
     }
 }
 
@@ -257,8 +248,42 @@ void Source::Impl::setCacheSize(size_t size) {
     cache.setSize(size);
 }
 
-void Source::Impl::onLowMemory() {
+void Source::Impl::setTileMemoryManager(TileMemoryManager* manager) {
+    // Annotation tiles are cheap to recreate, and change whenever an annotation does.
+    cache.setManager(type == SourceType::Annotations ? nullptr : manager);
+}
+
+SourceMemoryUsage Source::Impl::getMemoryUsage() const {
+    SourceMemoryUsage usage;
+    for (const auto& pair : tiles) {
+        usage.tiles += pair.second->getMemoryUsage();
+    }
+    usage.cache = cache.getMemoryUsage();
+    return usage;
+}
+
+void Source::Impl::onMemoryPressure(MemoryPressure pressure) {
+    if (pressure == MemoryPressure::Moderate) {
+        cache.releaseMemory();
+        return;
+    }
+
     cache.clear();
+
+    std::unordered_set<const Tile*> rendered;
+    for (const auto& pair : renderTiles) {
+        rendered.insert(&pair.second.tile);
+    }
+
+    // Tiles that are retained without being rendered, such as those still loading, are
+    // uploaded again once they are rendered. They keep their feature index, which they would
+    // recreate as soon as the tiles are next updated.
+    for (auto& pair : tiles) {
+        Tile& tile = *pair.second;
+        if (pressure == MemoryPressure::Background || !rendered.count(&tile)) {
+            tile.releaseGPUResources();
+        }
+    }
 }
 
 void Source::Impl::setObserver(SourceObserver* observer_) {
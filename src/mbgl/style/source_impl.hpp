@@ -15,6 +15,7 @@
 
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <map>
 
@@ -55,8 +56,8 @@ public:
     void removeTiles();
 
     // Request that all loaded tiles re-run the layout operation on the existing source
-    // data with fresh style information.
-    void reloadTiles();
+    // data with fresh style information, for the buckets with the given names.
+    void reloadTiles(const std::unordered_set<std::string>& bucketNames);
 
     void startRender(algorithm::ClipIDGenerator&,
                      const mat4& projMatrix,
@@ -69,7 +70,11 @@ public:
     queryRenderedFeatures(const QueryParameters&) const;
 
     void setCacheSize(size_t);
-    void onLowMemory();
+    // Tiles are only cached while the source belongs to a style.
+    void setTileMemoryManager(TileMemoryManager*);
+    SourceMemoryUsage getMemoryUsage() const;
+    // The tile cache is trimmed across all sources beforehand; see `Style::onMemoryPressure`.
+    void onMemoryPressure(MemoryPressure);
 
     void setObserver(SourceObserver*);
     void dumpDebugLogs() const;
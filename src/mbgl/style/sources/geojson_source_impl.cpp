@@ -122,7 +122,7 @@ void GeoJSONSource::Impl::loadDescription(FileSource& fileSource) {
                 base, std::make_exception_ptr(std::runtime_error("unexpectedly empty GeoJSON")));
         } else {
             rapidjson::GenericDocument<rapidjson::UTF8<>, rapidjson::CrtAllocator> d;
-            d.Parse<0>(res.data->c_str());
+            d.Parse<0>(res.data.data(), res.data.size());
 
             if (d.HasParseError()) {
                 std::stringstream message;
@@ -10,7 +10,7 @@ VectorSource::Impl::Impl(std::string id_, Source& base_, variant<std::string, Ti
 
 std::unique_ptr<Tile> VectorSource::Impl::createTile(const OverscaledTileID& tileID,
                                                      const UpdateParameters& parameters) {
-    return std::make_unique<VectorTile>(tileID, base.getID(), parameters, tileset);
+    return std::make_unique<VectorTile>(tileID, base.getID(), parameters, tileset, dataCache);
 }
 
 } // namespace style
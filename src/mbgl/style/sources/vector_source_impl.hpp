@@ -2,6 +2,7 @@
 
 #include <mbgl/style/sources/vector_source.hpp>
 #include <mbgl/style/tile_source_impl.hpp>
+#include <mbgl/tile/vector_tile_data_cache.hpp>
 
 namespace mbgl {
 namespace style {
@@ -12,6 +13,8 @@ public:
 
 private:
     std::unique_ptr<Tile> createTile(const OverscaledTileID&, const UpdateParameters&) final;
+
+    VectorTileDataCache dataCache;
 };
 
 } // namespace style
@@ -100,6 +100,7 @@ TransitionOptions Style::getTransitionOptions() const {
 void Style::setJSON(const std::string& json) {
     sources.clear();
     layers.clear();
+    layerSnapshots.clear();
     classes.clear();
     transitionOptions = {};
     updateBatch = {};
@@ -148,6 +149,10 @@ void Style::addSource(std::unique_ptr<Source> source) {
     }
 
     source->baseImpl->setObserver(this);
+    if (sourceCacheSize) {
+        source->baseImpl->setCacheSize(*sourceCacheSize);
+    }
+    source->baseImpl->setTileMemoryManager(&tileMemory);
     sources.emplace_back(std::move(source));
 }
 
@@ -161,6 +166,7 @@ std::unique_ptr<Source> Style::removeSource(const std::string& id) {
     }
 
     auto source = std::move(*it);
+    source->baseImpl->setTileMemoryManager(nullptr);
     sources.erase(it);
     updateBatch.sourceIDs.erase(id);
 
@@ -238,9 +244,18 @@ std::unique_ptr<Layer> Style::removeLayer(const std::string& id) {
     }
 
     layers.erase(it);
+    layerSnapshots.erase(layer.get());
     return layer;
 }
 
+std::shared_ptr<const Layer> Style::getLayerSnapshot(const Layer& layer) {
+    auto& snapshot = layerSnapshots[&layer];
+    if (!snapshot) {
+        snapshot = layer.baseImpl->clone();
+    }
+    return snapshot;
+}
+
 std::string Style::getName() const {
     return name;
 }
@@ -276,10 +291,10 @@ void Style::updateSymbolDependentTiles() {
 }
 
 void Style::relayout() {
-    for (const auto& sourceID : updateBatch.sourceIDs) {
-        Source* source = getSource(sourceID);
+    for (const auto& pair : updateBatch.sourceIDs) {
+        Source* source = getSource(pair.first);
         if (source && source->baseImpl->enabled) {
-            source->baseImpl->reloadTiles();
+            source->baseImpl->reloadTiles(pair.second);
         }
     }
     updateBatch.sourceIDs.clear();
@@ -555,14 +570,41 @@ float Style::getQueryRadius() const {
 
 
 void Style::setSourceTileCacheSize(size_t size) {
+    sourceCacheSize = size;
     for (const auto& source : sources) {
         source->baseImpl->setCacheSize(size);
     }
 }
 
-void Style::onLowMemory() {
+void Style::setTileCacheBytes(size_t bytes) {
+    tileMemory.setMaxBytes(bytes);
+}
+
+std::unordered_map<std::string, SourceMemoryUsage> Style::getSourceMemoryUsage() const {
+    std::unordered_map<std::string, SourceMemoryUsage> result;
+    for (const auto& source : sources) {
+        result.emplace(source->getID(), source->baseImpl->getMemoryUsage());
+    }
+    return result;
+}
+
+size_t Style::releaseCachedGPUResources(size_t bytes) {
+    return tileMemory.releaseGPUResources(bytes);
+}
+
+void Style::onMemoryPressure(MemoryPressure pressure) {
+    if (pressure == MemoryPressure::Moderate) {
+        tileMemory.trim(tileMemory.getBytes() / 2);
+    }
+
     for (const auto& source : sources) {
-        source->baseImpl->onLowMemory();
+        source->baseImpl->onMemoryPressure(pressure);
+    }
+
+    if (pressure == MemoryPressure::Background) {
+        glyphAtlas->releaseTexture();
+        spriteAtlas->releaseTexture();
+        lineAtlas->releaseTexture();
     }
 }
 
@@ -644,16 +686,30 @@ struct QueueSourceReloadVisitor {
 
     template <class VectorLayer>
     void operator()(VectorLayer& layer) {
-        updateBatch.sourceIDs.insert(layer.getSourceID());
+        updateBatch.sourceIDs[layer.getSourceID()].insert(layer.baseImpl->bucketName());
     }
 };
 
 void Style::onLayerFilterChanged(Layer& layer) {
+    layerSnapshots.erase(&layer);
+    layer.accept(QueueSourceReloadVisitor { updateBatch });
+    observer->onUpdate(Update::Layout);
+}
+
+void Style::onLayerSourceLayerChanged(Layer& layer) {
+    layerSnapshots.erase(&layer);
     layer.accept(QueueSourceReloadVisitor { updateBatch });
     observer->onUpdate(Update::Layout);
 }
 
+void Style::onLayerZoomRangeChanged(Layer& layer) {
+    layerSnapshots.erase(&layer);
+    layer.accept(QueueSourceReloadVisitor { updateBatch });
+    observer->onUpdate(Update::RecalculateStyle | Update::Layout);
+}
+
 void Style::onLayerVisibilityChanged(Layer& layer) {
+    layerSnapshots.erase(&layer);
     layer.accept(QueueSourceReloadVisitor { updateBatch });
     observer->onUpdate(Update::RecalculateStyle | Update::Layout);
 }
@@ -663,6 +719,7 @@ void Style::onLayerPaintPropertyChanged(Layer&) {
 }
 
 void Style::onLayerLayoutPropertyChanged(Layer& layer, const char * property) {
+    layerSnapshots.erase(&layer);
     layer.accept(QueueSourceReloadVisitor { updateBatch });
 
     auto update = Update::Layout;
@@ -675,12 +732,20 @@ void Style::onLayerLayoutPropertyChanged(Layer& layer, const char * property) {
     observer->onUpdate(update);
 }
 
+LayoutStatistics Style::getLayoutStatistics() const {
+    return layoutCounters.get();
+}
+
 void Style::dumpDebugLogs() const {
     for (const auto& source : sources) {
         source->baseImpl->dumpDebugLogs();
     }
 
     spriteAtlas->dumpDebugLogs();
+
+    const LayoutStatistics layouts = getLayoutStatistics();
+    Log::Info(Event::General, "GeometryTileWorker::completed: %s", util::toString(layouts.completed).c_str());
+    Log::Info(Event::General, "GeometryTileWorker::abandoned: %s", util::toString(layouts.abandoned).c_str());
 }
 
 } // namespace style
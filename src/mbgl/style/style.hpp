@@ -9,16 +9,20 @@
 #include <mbgl/sprite/sprite_atlas_observer.hpp>
 #include <mbgl/map/mode.hpp>
 #include <mbgl/map/zoom_history.hpp>
+#include <mbgl/tile/tile_memory_manager.hpp>
+#include <mbgl/tile/layout_counters.hpp>
 
 #include <mbgl/util/noncopyable.hpp>
 #include <mbgl/util/chrono.hpp>
 #include <mbgl/util/optional.hpp>
 #include <mbgl/util/feature.hpp>
 #include <mbgl/util/geo.hpp>
+#include <mbgl/util/memory_usage.hpp>
 
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace mbgl {
@@ -77,6 +81,11 @@ public:
                     optional<std::string> beforeLayerID = {});
     std::unique_ptr<Layer> removeLayer(const std::string& layerID);
 
+    // Returns an immutable copy of the layer's current state that can be shared with
+    // any number of workers. The copy is made on first use and reused until a change
+    // to the layer's layout, filter, or visibility invalidates it.
+    std::shared_ptr<const Layer> getLayerSnapshot(const Layer&);
+
     std::string getName() const;
     LatLng getDefaultLatLng() const;
     double getDefaultZoom() const;
@@ -99,8 +108,18 @@ public:
 
     float getQueryRadius() const;
 
+    // Applies to sources added later on, too.
     void setSourceTileCacheSize(size_t);
-    void onLowMemory();
+    // The budget for the cached tiles of all sources together.
+    void setTileCacheBytes(size_t);
+    std::unordered_map<std::string, SourceMemoryUsage> getSourceMemoryUsage() const;
+    // Makes cached tiles release their GPU resources, least recently cached first, until at
+    // least `bytes` are freed. Returns the number of bytes freed.
+    size_t releaseCachedGPUResources(size_t bytes);
+    void onMemoryPressure(MemoryPressure);
+
+    // The layouts and placements of the tiles of all sources since the style was created.
+    LayoutStatistics getLayoutStatistics() const;
 
     void dumpDebugLogs() const;
 
@@ -109,12 +128,22 @@ public:
     std::unique_ptr<SpriteAtlas> spriteAtlas;
     std::unique_ptr<LineAtlas> lineAtlas;
 
+    // Updated by the workers of the tiles, which are destroyed along with the sources.
+    LayoutCounters layoutCounters;
+
 private:
+    // Declared before the sources, whose tile caches are registered with it.
+    TileMemoryManager tileMemory;
+
     std::vector<std::unique_ptr<Source>> sources;
     std::vector<std::unique_ptr<Layer>> layers;
     std::vector<std::string> classes;
     TransitionOptions transitionOptions;
 
+    optional<size_t> sourceCacheSize;
+
+    std::unordered_map<const Layer*, std::shared_ptr<const Layer>> layerSnapshots;
+
     // Defaults
     std::string name;
     LatLng defaultLatLng;
@@ -144,6 +173,8 @@ private:
 
     // LayerObserver implementation.
     void onLayerFilterChanged(Layer&) override;
+    void onLayerSourceLayerChanged(Layer&) override;
+    void onLayerZoomRangeChanged(Layer&) override;
     void onLayerVisibilityChanged(Layer&) override;
     void onLayerPaintPropertyChanged(Layer&) override;
     void onLayerLayoutPropertyChanged(Layer&, const char *) override;
@@ -75,7 +75,7 @@ void TileSourceImpl::loadDescription(FileSource& fileSource) {
             // from the stylesheet. Then merge in the values parsed from the TileJSON we retrieved
             // via the URL.
             try {
-                newTileset = parseTileJSON(*res.data, url, type, tileSize);
+                newTileset = parseTileJSON(res.data.string(), url, type, tileSize);
             } catch (...) {
                 observer->onSourceError(base, std::current_exception());
                 return;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <unordered_map>
 #include <unordered_set>
 #include <string>
 
@@ -8,7 +9,8 @@ namespace style {
 
 class UpdateBatch {
 public:
-    std::unordered_set<std::string> sourceIDs;
+    // Names of the buckets whose layout was invalidated, by source ID.
+    std::unordered_map<std::string, std::unordered_set<std::string>> sourceIDs;
 };
 
 } // namespace style
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <mbgl/map/mode.hpp>
+#include <mbgl/util/constants.hpp>
+
+#include <cstddef>
 
 namespace mbgl {
 
@@ -39,6 +42,7 @@ public:
     FileSource& fileSource;
     const MapMode mode;
     AnnotationManager& annotationManager;
+    std::size_t parallelLayoutThreshold = util::DEFAULT_PARALLEL_LAYOUT_THRESHOLD;
 
     // TODO: remove
     Style& style;
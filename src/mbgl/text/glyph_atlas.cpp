@@ -216,6 +216,11 @@ void GlyphAtlas::upload(gl::Context& context, gl::TextureUnit unit) {
     dirty = false;
 }
 
+void GlyphAtlas::releaseTexture() {
+    std::lock_guard<std::mutex> lock(mtx);
+    texture = {};
+}
+
 void GlyphAtlas::bind(gl::Context& context, gl::TextureUnit unit) {
     upload(context, unit);
     context.bindTexture(*texture, unit, gl::TextureFilter::Linear);
@@ -14,8 +14,8 @@
 
 namespace {
 
-void parseGlyphPBF(mbgl::GlyphSet& glyphSet, const std::string& data) {
-    protozero::pbf_reader glyphs_pbf(data);
+void parseGlyphPBF(mbgl::GlyphSet& glyphSet, const mbgl::ByteBuffer& data) {
+    protozero::pbf_reader glyphs_pbf(data.data(), data.size());
 
     while (glyphs_pbf.next(1)) {
         auto fontstack_pbf = glyphs_pbf.get_message();
@@ -79,7 +79,7 @@ GlyphPBF::GlyphPBF(GlyphAtlas* atlas,
             observer->onGlyphsLoaded(fontStack, glyphRange);
         } else {
             try {
-                parseGlyphPBF(**atlas->getGlyphSet(fontStack), *res.data);
+                parseGlyphPBF(**atlas->getGlyphSet(fontStack), res.data);
             } catch (...) {
                 observer->onGlyphsError(fontStack, glyphRange, std::current_exception());
                 return;
@@ -0,0 +1,100 @@
+#include <mbgl/tile/flat_geometry.hpp>
+
+#include <algorithm>
+
+namespace mbgl {
+
+FlatGeometry::FlatGeometry(const GeometryCollection& collection) {
+    assign(collection);
+}
+
+GeometryRing FlatGeometry::ring(std::size_t i) const {
+    const std::size_t start = ringStarts[i];
+    const std::size_t end = i + 1 < ringStarts.size() ? ringStarts[i + 1] : points.size();
+    return { points.data() + start, end - start };
+}
+
+void FlatGeometry::assign(const GeometryCollection& collection) {
+    clear();
+    for (const auto& ring : collection) {
+        beginRing();
+        points.insert(points.end(), ring.begin(), ring.end());
+    }
+}
+
+GeometryCollection FlatGeometry::toCollection() const {
+    GeometryCollection collection;
+    collection.reserve(ringCount());
+    for (std::size_t i = 0; i < ringCount(); ++i) {
+        const GeometryRing r = ring(i);
+        collection.emplace_back(r.begin(), r.end());
+    }
+    return collection;
+}
+
+double signedArea(const GeometryRing& ring) {
+    double sum = 0;
+
+    for (std::size_t i = 0, len = ring.size(), j = len - 1; i < len; j = i++) {
+        const GeometryCoordinate& p1 = ring[i];
+        const GeometryCoordinate& p2 = ring[j];
+        sum += (p2.x - p1.x) * (p1.y + p2.y);
+    }
+
+    return sum;
+}
+
+void RingPolygons::classify(const FlatGeometry& geometry) {
+    rings.clear();
+    polygonStarts.clear();
+
+    const std::size_t len = geometry.ringCount();
+
+    if (len <= 1) {
+        polygonStarts.push_back(0);
+        if (len == 1) {
+            rings.push_back(geometry.ring(0));
+        }
+        return;
+    }
+
+    int8_t ccw = 0;
+
+    for (std::size_t i = 0; i < len; i++) {
+        const GeometryRing ring = geometry.ring(i);
+        double area = signedArea(ring);
+
+        if (area == 0)
+            continue;
+
+        if (ccw == 0)
+            ccw = (area < 0 ? -1 : 1);
+
+        // A ring with the same winding as the first one starts a new polygon.
+        if (polygonStarts.empty() || ccw == (area < 0 ? -1 : 1)) {
+            polygonStarts.push_back(rings.size());
+        }
+
+        rings.push_back(ring);
+    }
+}
+
+void RingPolygons::getPolygon(std::size_t i, std::vector<GeometryRing>& polygon) const {
+    const std::size_t start = polygonStarts[i];
+    const std::size_t end = i + 1 < polygonStarts.size() ? polygonStarts[i + 1] : rings.size();
+    polygon.assign(rings.begin() + start, rings.begin() + end);
+}
+
+void limitHoles(std::vector<GeometryRing>& polygon, uint32_t maxHoles) {
+    if (polygon.size() > 1 + maxHoles) {
+        std::nth_element(polygon.begin() + 1,
+                         polygon.begin() + 1 + maxHoles,
+                         polygon.end(),
+                         [] (const auto& a, const auto& b) {
+                             return signedArea(a) > signedArea(b);
+                         });
+        polygon.erase(polygon.begin() + 1 + maxHoles, polygon.end());
+    }
+}
+
+} // namespace mbgl
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <mbgl/tile/geometry_tile_data.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace mbgl {
+
+// A read-only view of consecutive points: one ring of a `FlatGeometry`, or all of a
+// `GeometryCoordinates`. It provides the parts of the `std::vector` interface that geometry
+// algorithms such as earcut rely on.
+class GeometryRing {
+public:
+    using value_type = GeometryCoordinate;
+    using coordinate_type = int16_t;
+    using const_iterator = const GeometryCoordinate*;
+
+    GeometryRing(const GeometryCoordinate* first_, std::size_t count_)
+        : first(first_), count(count_) {}
+
+    GeometryRing(const GeometryCoordinates& coordinates)
+        : first(coordinates.data()), count(coordinates.size()) {}
+
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    const GeometryCoordinate& operator[](std::size_t i) const { return first[i]; }
+    const GeometryCoordinate& front() const { return first[0]; }
+    const GeometryCoordinate& back() const { return first[count - 1]; }
+
+    const_iterator begin() const { return first; }
+    const_iterator end() const { return first + count; }
+
+private:
+    const GeometryCoordinate* first;
+    std::size_t count;
+};
+
+/*
+    A `FlatGeometry` stores the rings of a feature's geometry in a single point buffer, along
+    with the offset at which each ring starts. It is the flat counterpart to a
+    `GeometryCollection`, which allocates a separate vector for each ring.
+
+    `clear()` keeps the memory that is already allocated. Reading every feature of a tile into
+    the same `FlatGeometry` therefore only allocates until its buffers have grown to fit the
+    largest feature; each layout keeps one per concurrent bucket build, see `GeometryBuffers`.
+*/
+class FlatGeometry {
+public:
+    FlatGeometry() = default;
+    explicit FlatGeometry(const GeometryCollection&);
+
+    void clear() {
+        points.clear();
+        ringStarts.clear();
+    }
+
+    // Starts a new ring, to which subsequently added points belong.
+    void beginRing() {
+        ringStarts.push_back(static_cast<uint32_t>(points.size()));
+    }
+
+    void addPoint(const GeometryCoordinate& point) {
+        points.push_back(point);
+    }
+
+    std::size_t ringCount() const { return ringStarts.size(); }
+    GeometryRing ring(std::size_t i) const;
+
+    // The points of all rings, in order.
+    GeometryRing allPoints() const { return { points.data(), points.size() }; }
+
+    void assign(const GeometryCollection&);
+    GeometryCollection toCollection() const;
+
+private:
+    std::vector<GeometryCoordinate> points;
+    std::vector<uint32_t> ringStarts;
+};
+
+double signedArea(const GeometryRing&);
+
+/*
+    Polygons made up of the rings of a `FlatGeometry`: each polygon is an outer ring followed by
+    its holes. Like `classifyRings(const GeometryCollection&)`, but the rings refer to the
+    geometry's points instead of copying them, and `classify` reuses the memory from previous
+    calls.
+*/
+class RingPolygons {
+public:
+    void classify(const FlatGeometry&);
+
+    std::size_t polygonCount() const { return polygonStarts.size(); }
+
+    // Replaces the contents of `polygon` with the rings of polygon `i`.
+    void getPolygon(std::size_t i, std::vector<GeometryRing>& polygon) const;
+
+private:
+    std::vector<GeometryRing> rings;
+    std::vector<std::size_t> polygonStarts;
+};
+
+// Truncate polygon to the largest `maxHoles` inner rings by area.
+void limitHoles(std::vector<GeometryRing>& polygon, uint32_t maxHoles);
+
+/*
+    Scratch space for building one bucket: the geometry of the current feature, and the
+    polygons that fill buckets split it into. It keeps its memory from one feature to the next,
+    and only lives as long as a layout, as the rings of the polygons point into the geometry.
+*/
+class GeometryBuffers {
+public:
+    FlatGeometry geometry;
+    RingPolygons polygons;
+    std::vector<GeometryRing> polygon;
+};
+
+} // namespace mbgl
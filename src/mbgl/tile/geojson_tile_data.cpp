@@ -0,0 +1,73 @@
+#include <mbgl/tile/geojson_tile_data.hpp>
+#include <mbgl/tile/flat_geometry.hpp>
+
+namespace mbgl {
+
+GeoJSONTileFeature::GeoJSONTileFeature(const GeoJSONTileData& data_, std::size_t index_)
+    : data(data_),
+      index(index_),
+      feature(data.features[index]) {
+}
+
+FeatureType GeoJSONTileFeature::getType() const {
+    return apply_visitor(ToFeatureType(), feature.geometry);
+}
+
+PropertyMap GeoJSONTileFeature::getProperties() const {
+    return feature.properties;
+}
+
+optional<Value> GeoJSONTileFeature::getValue(const std::string& key) const {
+    auto it = feature.properties.find(key);
+    if (it != feature.properties.end()) {
+        return optional<Value>(it->second);
+    }
+    return optional<Value>();
+}
+
+GeometryCollection GeoJSONTileFeature::getGeometries() const {
+    if (getType() == FeatureType::Polygon) {
+        return data.getPolygon(index);
+    }
+    return apply_visitor(ToGeometryCollection(), feature.geometry);
+}
+
+void GeoJSONTileFeature::readGeometries(FlatGeometry& geometry) const {
+    if (getType() == FeatureType::Polygon) {
+        geometry.assign(data.getPolygon(index));
+    } else {
+        geometry.assign(apply_visitor(ToGeometryCollection(), feature.geometry));
+    }
+}
+
+GeoJSONTileData::GeoJSONTileData(mapbox::geometry::feature_collection<int16_t> features_)
+    : features(std::move(features_)),
+      polygonsFixed(features.size()),
+      polygons(features.size()) {
+}
+
+const GeometryTileLayer* GeoJSONTileData::getLayer(const std::string&) const {
+    return this;
+}
+
+std::string GeoJSONTileData::getName() const {
+    return "";
+}
+
+std::size_t GeoJSONTileData::featureCount() const {
+    return features.size();
+}
+
+std::unique_ptr<GeometryTileFeature> GeoJSONTileData::getFeature(std::size_t i) const {
+    return std::make_unique<GeoJSONTileFeature>(*this, i);
+}
+
+const GeometryCollection& GeoJSONTileData::getPolygon(std::size_t i) const {
+    std::call_once(polygonsFixed[i], [&] {
+        // https://github.com/mapbox/geojson-vt-cpp/issues/44
+        polygons[i] = fixupPolygons(apply_visitor(ToGeometryCollection(), features[i].geometry));
+    });
+    return polygons[i];
+}
+
+} // namespace mbgl
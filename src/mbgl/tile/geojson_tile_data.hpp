@@ -0,0 +1,58 @@
+#pragma once
+
+#include <mbgl/tile/geometry_tile_data.hpp>
+#include <mbgl/util/feature.hpp>
+
+#include <mutex>
+#include <vector>
+
+namespace mbgl {
+
+class GeoJSONTileData;
+
+class GeoJSONTileFeature : public GeometryTileFeature {
+public:
+    GeoJSONTileFeature(const GeoJSONTileData&, std::size_t index);
+
+    FeatureType getType() const override;
+    PropertyMap getProperties() const override;
+    optional<Value> getValue(const std::string& key) const override;
+    GeometryCollection getGeometries() const override;
+    void readGeometries(FlatGeometry&) const override;
+
+private:
+    const GeoJSONTileData& data;
+    const std::size_t index;
+    const mapbox::geometry::feature<int16_t>& feature;
+};
+
+/*
+    A simple in-memory tile type that holds GeoJSON values. A GeoJSON tile can only have one
+    layer, and it is always returned regardless of which layer is requested.
+
+    Polygons are fixed up with `fixupPolygons` the first time that their geometry is read, and
+    kept that way, since buckets, symbol layout and queries each read it again. Reads may happen
+    from several threads at once.
+*/
+class GeoJSONTileData : public GeometryTileData,
+                        public GeometryTileLayer {
+public:
+    GeoJSONTileData(mapbox::geometry::feature_collection<int16_t>);
+
+    const GeometryTileLayer* getLayer(const std::string&) const override;
+    std::string getName() const override;
+    std::size_t featureCount() const override;
+    std::unique_ptr<GeometryTileFeature> getFeature(std::size_t) const override;
+
+private:
+    friend class GeoJSONTileFeature;
+
+    const GeometryCollection& getPolygon(std::size_t) const;
+
+    const mapbox::geometry::feature_collection<int16_t> features;
+
+    mutable std::vector<std::once_flag> polygonsFixed;
+    mutable std::vector<GeometryCollection> polygons;
+};
+
+} // namespace mbgl
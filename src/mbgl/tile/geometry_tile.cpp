@@ -1,6 +1,7 @@
 #include <mbgl/tile/geometry_tile.hpp>
 #include <mbgl/tile/geometry_tile_worker.hpp>
 #include <mbgl/tile/geometry_tile_data.hpp>
+#include <mbgl/tile/shared_buckets.hpp>
 #include <mbgl/tile/tile_observer.hpp>
 #include <mbgl/style/update_parameters.hpp>
 #include <mbgl/style/layer_impl.hpp>
@@ -13,6 +14,8 @@
 #include <mbgl/map/transform_state.hpp>
 #include <mbgl/util/run_loop.hpp>
 
+#include <algorithm>
+
 namespace mbgl {
 
 using namespace style;
@@ -29,7 +32,10 @@ GeometryTile::GeometryTile(const OverscaledTileID& id_,
              id_,
              *parameters.style.glyphAtlas,
              obsolete,
-             parameters.mode) {
+             parameters.mode,
+             parameters.workerScheduler,
+             parameters.parallelLayoutThreshold,
+             parameters.style.layoutCounters) {
 }
 
 GeometryTile::~GeometryTile() {
@@ -40,11 +46,28 @@ void GeometryTile::cancel() {
     obsolete = true;
 }
 
+void GeometryTile::setNecessity(Necessity necessity) {
+    // Required tiles are laid out before optional ones, such as those kept around as a
+    // fallback for tiles still loading, or those that just moved into the TileCache.
+    worker.setPriority(necessity == Necessity::Required ? Mailbox::Priority::High
+                                                        : Mailbox::Priority::Low);
+
+    // Only tiles in the TileCache release their feature index, so this is the first necessity,
+    // required or optional, given to a tile retained from the cache. The worker doesn't keep a
+    // copy of the feature index, so it is rebuilt along with the buckets; shared buckets come
+    // with their entries, though.
+    if (featureIndexReleased) {
+        featureIndexReleased = false;
+        setLayers({}, true);
+    }
+}
+
 void GeometryTile::setError(std::exception_ptr err) {
     observer->onTileError(*this, err);
 }
 
-void GeometryTile::setData(std::unique_ptr<const GeometryTileData> data_) {
+void GeometryTile::setData(std::shared_ptr<const GeometryTileData> data_,
+                           std::shared_ptr<SharedBuckets> sharedBuckets_) {
     // Mark the tile as pending again if it was complete before to prevent signaling a complete
     // state despite pending parse operations.
     if (availableData == DataAvailability::All) {
@@ -52,8 +75,17 @@ void GeometryTile::setData(std::unique_ptr<const GeometryTileData> data_) {
     }
 
     ++correlationID;
-    worker.invoke(&GeometryTileWorker::setData, std::move(data_), correlationID);
-    redoLayout();
+    if (sharedBuckets_ != sharedBuckets) {
+        if (sharedBuckets) {
+            retiredSharedBuckets.push_back(std::move(sharedBuckets));
+        }
+        sharedBuckets = std::move(sharedBuckets_);
+        sharedBucketsCorrelationID = correlationID;
+    }
+    worker.invoke(&GeometryTileWorker::setData, std::move(data_), sharedBuckets.get(), correlationID);
+
+    // New data invalidates all buckets.
+    setLayers({});
 }
 
 void GeometryTile::setPlacementConfig(const PlacementConfig& desiredConfig) {
@@ -76,17 +108,26 @@ void GeometryTile::symbolDependenciesChanged() {
     worker.invoke(&GeometryTileWorker::symbolDependenciesChanged);
 }
 
-void GeometryTile::redoLayout() {
+void GeometryTile::redoLayout(const std::unordered_set<std::string>& bucketNames) {
+    // The TileCache relays invalidations just before the tile is retained. If it released the
+    // feature index, `setNecessity` rebuilds every bucket anyway.
+    if (featureIndexReleased) {
+        return;
+    }
+    setLayers(bucketNames);
+}
+
+void GeometryTile::setLayers(std::unordered_set<std::string> invalidatedBuckets, bool invalidateAll) {
     // Mark the tile as pending again if it was complete before to prevent signaling a complete
     // state despite pending parse operations.
     if (availableData == DataAvailability::All) {
         availableData = DataAvailability::Some;
     }
 
-    std::vector<std::unique_ptr<Layer>> copy;
+    std::vector<std::shared_ptr<const Layer>> snapshots;
 
     for (const Layer* layer : style.getLayers()) {
-        // Avoid cloning and including irrelevant layers.
+        // Avoid snapshotting and including irrelevant layers.
         if (layer->is<BackgroundLayer>() ||
             layer->is<CustomLayer>() ||
             layer->baseImpl->source != sourceID ||
@@ -96,18 +137,75 @@ void GeometryTile::redoLayout() {
             continue;
         }
 
-        copy.push_back(layer->baseImpl->clone());
+        snapshots.push_back(style.getLayerSnapshot(*layer));
+
+        if (invalidateAll) {
+            invalidatedBuckets.insert(layer->baseImpl->bucketName());
+        }
     }
 
     ++correlationID;
-    worker.invoke(&GeometryTileWorker::setLayers, std::move(copy), correlationID);
+    worker.invoke(&GeometryTileWorker::setLayers, std::move(snapshots), std::move(invalidatedBuckets), correlationID);
 }
 
 void GeometryTile::onLayout(LayoutResult result) {
-    availableData = DataAvailability::Some;
-    buckets = std::move(result.buckets);
-    featureIndex = std::move(result.featureIndex);
+    if (result.placementValid && result.correlationID == correlationID) {
+        availableData = DataAvailability::All;
+    } else {
+        availableData = DataAvailability::Some;
+    }
+
+    bool indexComplete = true;
+
+    if (result.rebuiltBuckets) {
+        const auto& rebuilt = *result.rebuiltBuckets;
+
+        for (auto it = buckets.begin(); it != buckets.end();) {
+            if (rebuilt.count(it->first) || !result.bucketNames.count(it->first)) {
+                it = buckets.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        for (auto& bucket : result.buckets) {
+            buckets[bucket.first] = std::move(bucket.second);
+        }
+
+        for (const auto& name : result.bucketNames) {
+            if (rebuilt.count(name)) {
+                continue;
+            }
+            if (!featureIndex) {
+                // The index was released before this layout arrived; the layout requested
+                // by `setNecessity` rebuilds all of it.
+                indexComplete = false;
+                break;
+            }
+            result.featureIndex->insertBucket(*featureIndex, name);
+        }
+    } else {
+        buckets = std::move(result.buckets);
+    }
+
+    if (indexComplete) {
+        // No placement is coming, so keep the symbols placed for the previous feature index.
+        if (result.placementValid && featureIndex) {
+            result.featureIndex->setCollisionTile(featureIndex->releaseCollisionTile());
+        }
+
+        featureIndex = std::move(result.featureIndex);
+        featureIndexReleased = false;
+    }
+
     data = std::move(result.tileData);
+
+    releaseRetiredSharedBuckets(result.correlationID);
+
+    // Shared buckets that this tile no longer uses may not be needed by any other tile either.
+    if (sharedBuckets) {
+        sharedBuckets->prune();
+    }
+
     observer->onTileChanged(*this);
 }
 
@@ -118,10 +216,23 @@ void GeometryTile::onPlacement(PlacementResult result) {
     for (auto& bucket : result.buckets) {
         buckets[bucket.first] = std::move(bucket.second);
     }
-    featureIndex->setCollisionTile(std::move(result.collisionTile));
+    // The feature index may have been released in the meantime; placement is redone once it
+    // is back.
+    if (featureIndex) {
+        featureIndex->setCollisionTile(std::move(result.collisionTile));
+    }
+    releaseRetiredSharedBuckets(result.correlationID);
     observer->onTileChanged(*this);
 }
 
+void GeometryTile::releaseRetiredSharedBuckets(uint64_t resultCorrelationID) {
+    // The worker handles messages in order, so it has switched to the current shared buckets
+    // by the time it reports on the message that handed them over, or on any later one.
+    if (resultCorrelationID >= sharedBucketsCorrelationID) {
+        retiredSharedBuckets.clear();
+    }
+}
+
 void GeometryTile::onError(std::exception_ptr err) {
     availableData = DataAvailability::All;
     observer->onTileError(*this, err);
@@ -137,6 +248,53 @@ Bucket* GeometryTile::getBucket(const Layer& layer) {
     return it->second.get();
 }
 
+std::size_t GeometryTile::bucketUseCount(const std::shared_ptr<Bucket>& bucket) const {
+    const std::size_t count = sharedBuckets ? sharedBuckets->useCount(bucket)
+                                            : std::size_t(bucket.use_count());
+    return std::max<std::size_t>(1, count);
+}
+
+MemoryUsage GeometryTile::getMemoryUsage() const {
+    // Buckets and data that are shared with other tiles count towards each of them in equal
+    // parts, so that they only count once in the sum over all tiles.
+    MemoryUsage usage;
+    for (const auto& entry : buckets) {
+        usage += entry.second->getMemoryUsage() / bucketUseCount(entry.second);
+    }
+    if (featureIndex) {
+        usage.cpu += featureIndex->byteSize();
+    }
+    if (data) {
+        // Tiles that share their data also share the buckets built from it, and only tiles
+        // hold on to those.
+        const std::size_t tiles = sharedBuckets ? std::size_t(sharedBuckets.use_count()) : 1;
+        usage.cpu += data->byteSize() / std::max<std::size_t>(1, tiles);
+    }
+    return usage;
+}
+
+void GeometryTile::releaseGPUResources() {
+    for (auto& entry : buckets) {
+        // Buckets shared with other tiles may be displayed by them, and would only be uploaded
+        // again.
+        if (bucketUseCount(entry.second) == 1) {
+            entry.second->releaseGPUResources();
+        }
+    }
+}
+
+void GeometryTile::releaseFeatureIndex() {
+    if (!featureIndex) {
+        return;
+    }
+
+    featureIndex.reset();
+    featureIndexReleased = true;
+
+    // The collision tile went with the feature index, so symbols have to be placed again.
+    requestedConfig = {};
+}
+
 void GeometryTile::queryRenderedFeatures(
     std::unordered_map<std::string, std::vector<Feature>>& result,
     const GeometryCoordinates& queryGeometry,
@@ -9,12 +9,14 @@
 #include <atomic>
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace mbgl {
 
 class GeometryTileData;
 class FeatureIndex;
+class SharedBuckets;
 class CollisionTile;
 
 namespace style {
@@ -31,14 +33,21 @@ public:
 
     ~GeometryTile() override;
 
+    void setNecessity(Necessity) override;
+
     void setError(std::exception_ptr);
-    void setData(std::unique_ptr<const GeometryTileData>);
+    // Tiles that display the same canonical tile may pass the same `SharedBuckets`.
+    void setData(std::shared_ptr<const GeometryTileData>,
+                 std::shared_ptr<SharedBuckets> = nullptr);
 
     void setPlacementConfig(const PlacementConfig&) override;
     void symbolDependenciesChanged() override;
-    void redoLayout() override;
+    void redoLayout(const std::unordered_set<std::string>& bucketNames) override;
 
     Bucket* getBucket(const style::Layer&) override;
+    MemoryUsage getMemoryUsage() const override;
+    void releaseGPUResources() override;
+    void releaseFeatureIndex() override;
 
     void queryRenderedFeatures(
             std::unordered_map<std::string, std::vector<Feature>>& result,
@@ -50,9 +59,24 @@ public:
 
     class LayoutResult {
     public:
-        std::unordered_map<std::string, std::unique_ptr<Bucket>> buckets;
+        std::unordered_map<std::string, std::shared_ptr<Bucket>> buckets;
+
+        // Set for incremental layouts: the names of the buckets that were rebuilt. The other
+        // buckets of the layout remain valid, along with their entries in the previous feature
+        // index. If not set, `buckets` and `featureIndex` replace the previous ones.
+        optional<std::unordered_set<std::string>> rebuiltBuckets;
+
+        // The names of all buckets of the layout. Buckets of layers that were removed or
+        // hidden aren't among them.
+        std::unordered_set<std::string> bucketNames;
+
+        // For incremental layouts, only has the entries of the rebuilt buckets.
         std::unique_ptr<FeatureIndex> featureIndex;
-        std::unique_ptr<GeometryTileData> tileData;
+        std::shared_ptr<const GeometryTileData> tileData;
+
+        // True if the previous placement still applies, and no PlacementResult will follow.
+        bool placementValid;
+
         uint64_t correlationID;
     };
     void onLayout(LayoutResult);
@@ -68,21 +92,43 @@ public:
     void onError(std::exception_ptr);
 
 private:
+    // With `invalidateAll`, every bucket is rebuilt, which also rebuilds the feature index.
+    void setLayers(std::unordered_set<std::string> invalidatedBuckets, bool invalidateAll = false);
+
+    // Releases the shared buckets that the worker no longer refers to, now that it sent a
+    // result for the message with the given correlation ID.
+    void releaseRetiredSharedBuckets(uint64_t resultCorrelationID);
+
+    // The number of tiles that use `bucket`, including this one.
+    std::size_t bucketUseCount(const std::shared_ptr<Bucket>&) const;
+
     const std::string sourceID;
     style::Style& style;
 
     // Used to signal the worker that it should abandon parsing this tile as soon as possible.
     std::atomic<bool> obsolete { false };
 
+    // Owned here rather than by the worker, so that the buckets are released on this thread,
+    // where they were uploaded. The worker only refers to them: ones that it may still be
+    // using are retired, and kept until it sent a result for the data that replaced them.
+    // Declared before the worker, which is destroyed first.
+    std::shared_ptr<SharedBuckets> sharedBuckets;
+    std::vector<std::shared_ptr<SharedBuckets>> retiredSharedBuckets;
+    uint64_t sharedBucketsCorrelationID = 0;
+
     std::shared_ptr<Mailbox> mailbox;
     Actor<GeometryTileWorker> worker;
 
     uint64_t correlationID = 0;
     optional<PlacementConfig> requestedConfig;
 
-    std::unordered_map<std::string, std::unique_ptr<Bucket>> buckets;
+    // Fill, line and circle buckets may be shared with other tiles of the same canonical tile.
+    std::unordered_map<std::string, std::shared_ptr<Bucket>> buckets;
     std::unique_ptr<FeatureIndex> featureIndex;
-    std::unique_ptr<const GeometryTileData> data;
+    std::shared_ptr<const GeometryTileData> data;
+
+    // Set when the feature index was released, until a layout brings it back.
+    bool featureIndexReleased = false;
 };
 
 } // namespace mbgl
@@ -1,21 +1,12 @@
 #include <mbgl/tile/geometry_tile_data.hpp>
+#include <mbgl/tile/flat_geometry.hpp>
 #include <mbgl/tile/tile_id.hpp>
 
 #include <clipper/clipper.hpp>
 
-namespace mbgl {
-
-static double signedArea(const GeometryCoordinates& ring) {
-    double sum = 0;
+#include <algorithm>
 
-    for (std::size_t i = 0, len = ring.size(), j = len - 1; i < len; j = i++) {
-        const GeometryCoordinate& p1 = ring[i];
-        const GeometryCoordinate& p2 = ring[j];
-        sum += (p2.x - p1.x) * (p1.y + p2.y);
-    }
-
-    return sum;
-}
+namespace mbgl {
 
 static ClipperLib::Path toClipperPath(const GeometryCoordinates& ring) {
     ClipperLib::Path result;
@@ -66,7 +57,182 @@ static void processPolynodeBranch(ClipperLib::PolyNode* polynode, GeometryCollec
     }
 }
 
+namespace {
+
+class Box {
+public:
+    int16_t minX, minY, maxX, maxY;
+
+    bool contains(const Box& other) const {
+        return minX <= other.minX && other.maxX <= maxX && minY <= other.minY && other.maxY <= maxY;
+    }
+
+    bool intersects(const Box& other) const {
+        return minX <= other.maxX && other.minX <= maxX && minY <= other.maxY && other.minY <= maxY;
+    }
+};
+
+class Edge {
+public:
+    GeometryCoordinate a, b;
+    Box box;
+    std::size_t ring;
+    std::size_t index;
+};
+
+int64_t cross(const GeometryCoordinate& o, const GeometryCoordinate& a, const GeometryCoordinate& b) {
+    return int64_t(a.x - o.x) * (b.y - o.y) - int64_t(a.y - o.y) * (b.x - o.x);
+}
+
+int sign(int64_t value) {
+    return (value > 0) - (value < 0);
+}
+
+// Whether `p`, which is collinear with segment `a`-`b`, lies on it.
+bool onSegment(const GeometryCoordinate& a, const GeometryCoordinate& b, const GeometryCoordinate& p) {
+    return std::min(a.x, b.x) <= p.x && p.x <= std::max(a.x, b.x) &&
+           std::min(a.y, b.y) <= p.y && p.y <= std::max(a.y, b.y);
+}
+
+// Whether two edges cross or touch, including at their end points.
+bool intersects(const Edge& e, const Edge& f) {
+    const int d1 = sign(cross(e.a, e.b, f.a));
+    const int d2 = sign(cross(e.a, e.b, f.b));
+    const int d3 = sign(cross(f.a, f.b, e.a));
+    const int d4 = sign(cross(f.a, f.b, e.b));
+
+    return (d1 * d2 < 0 && d3 * d4 < 0) ||
+           (d1 == 0 && onSegment(e.a, e.b, f.a)) ||
+           (d2 == 0 && onSegment(e.a, e.b, f.b)) ||
+           (d3 == 0 && onSegment(f.a, f.b, e.a)) ||
+           (d4 == 0 && onSegment(f.a, f.b, e.b));
+}
+
+// Consecutive edges `e` and `f` of a ring share an end point, but must not fold back onto
+// each other.
+bool foldsBack(const Edge& e, const Edge& f) {
+    return (cross(e.a, e.b, f.b) == 0 && onSegment(e.a, e.b, f.b)) ||
+           (cross(f.a, f.b, e.a) == 0 && onSegment(f.a, f.b, e.a));
+}
+
+bool pointInRing(const GeometryCoordinate& p, const GeometryCoordinates& ring) {
+    bool inside = false;
+    for (std::size_t i = 0, j = ring.size() - 1; i < ring.size(); j = i++) {
+        const GeometryCoordinate& a = ring[i];
+        const GeometryCoordinate& b = ring[j];
+        if ((a.y > p.y) != (b.y > p.y) &&
+            p.x < double(b.x - a.x) * (p.y - a.y) / (b.y - a.y) + a.x) {
+            inside = !inside;
+        }
+    }
+    return inside;
+}
+
+// Whether `rings` already are what `fixupPolygons` would turn them into: closed rings without
+// repeated points, each outer ring wound positively and followed by its negatively wound holes,
+// and no two edges crossing or touching. This is much cheaper than a Clipper union, and holds
+// for most polygons in practice.
+bool isStrictlySimplePolygon(const GeometryCollection& rings) {
+    std::vector<Box> boxes;
+    std::vector<bool> exterior;
+    std::vector<Edge> edges;
+
+    for (std::size_t r = 0; r < rings.size(); ++r) {
+        const GeometryCoordinates& ring = rings[r];
+        if (ring.size() < 4 || ring.front() != ring.back()) {
+            return false;
+        }
+
+        const double area = signedArea(ring);
+        if (area == 0 || (r == 0 && area < 0)) {
+            return false;
+        }
+        exterior.push_back(area > 0);
+
+        Box box { ring[0].x, ring[0].y, ring[0].x, ring[0].y };
+        for (std::size_t i = 0; i + 1 < ring.size(); ++i) {
+            const GeometryCoordinate& a = ring[i];
+            const GeometryCoordinate& b = ring[i + 1];
+            if (a == b) {
+                return false;
+            }
+            const Box edgeBox { std::min(a.x, b.x), std::min(a.y, b.y), std::max(a.x, b.x), std::max(a.y, b.y) };
+            edges.push_back({ a, b, edgeBox, r, i });
+            box = { std::min(box.minX, edgeBox.minX), std::min(box.minY, edgeBox.minY),
+                    std::max(box.maxX, edgeBox.maxX), std::max(box.maxY, edgeBox.maxY) };
+        }
+        boxes.push_back(box);
+    }
+
+    // Sweep from left to right, only testing edges whose extents overlap.
+    std::sort(edges.begin(), edges.end(), [] (const Edge& e, const Edge& f) {
+        return e.box.minX < f.box.minX;
+    });
+
+    for (std::size_t i = 0; i < edges.size(); ++i) {
+        const Edge& e = edges[i];
+        for (std::size_t j = i + 1; j < edges.size() && edges[j].box.minX <= e.box.maxX; ++j) {
+            const Edge& f = edges[j];
+            if (!e.box.intersects(f.box)) {
+                continue;
+            }
+
+            if (e.ring == f.ring) {
+                const std::size_t last = rings[e.ring].size() - 2;
+                const std::size_t lo = std::min(e.index, f.index);
+                const std::size_t hi = std::max(e.index, f.index);
+                if (hi == lo + 1 || (lo == 0 && hi == last)) {
+                    // The last edge of a ring is followed by the first one.
+                    const bool eFirst = hi == lo + 1 ? e.index == lo : e.index == hi;
+                    if (eFirst ? foldsBack(e, f) : foldsBack(f, e)) {
+                        return false;
+                    }
+                    continue;
+                }
+            }
+
+            if (intersects(e, f)) {
+                return false;
+            }
+        }
+    }
+
+    // With no edges touching, a ring lies either entirely inside or outside of another. Holes
+    // must lie inside their outer ring, and not inside another hole or another outer ring.
+    std::size_t outer = 0;
+    for (std::size_t r = 0; r < rings.size(); ++r) {
+        if (exterior[r]) {
+            outer = r;
+            for (std::size_t o = 0; o < r; ++o) {
+                if (exterior[o] && boxes[o].intersects(boxes[r]) &&
+                    (pointInRing(rings[r][0], rings[o]) || pointInRing(rings[o][0], rings[r]))) {
+                    return false;
+                }
+            }
+            continue;
+        }
+
+        if (!boxes[outer].contains(boxes[r]) || !pointInRing(rings[r][0], rings[outer])) {
+            return false;
+        }
+        for (std::size_t h = outer + 1; h < r; ++h) {
+            if (boxes[h].intersects(boxes[r]) &&
+                (pointInRing(rings[r][0], rings[h]) || pointInRing(rings[h][0], rings[r]))) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+} // namespace
+
 GeometryCollection fixupPolygons(const GeometryCollection& rings) {
+    if (isStrictlySimplePolygon(rings)) {
+        return rings;
+    }
+
     ClipperLib::Clipper clipper;
     clipper.StrictlySimple(true);
 
@@ -214,4 +380,27 @@ Feature convertFeature(const GeometryTileFeature& geometryTileFeature, const Can
     return feature;
 }
 
+void GeometryTileFeature::readGeometries(FlatGeometry& geometry) const {
+    geometry.assign(getGeometries());
+}
+
+void GeometryTileFeature::getValues(const ResolvedKeys& keys, std::vector<optional<Value>>& values) const {
+    values.resize(keys.names.size());
+    for (std::size_t i = 0; i < keys.names.size(); ++i) {
+        values[i] = getValue(keys.names[i]);
+    }
+}
+
+ResolvedKeys GeometryTileLayer::resolveKeys(std::vector<std::string> names) const {
+    return { std::move(names), {} };
+}
+
+void GeometryTileLayer::eachFeature(const std::function<bool (const GeometryTileFeature&, std::size_t)>& visitor) const {
+    for (std::size_t i = 0; i < featureCount(); ++i) {
+        if (!visitor(*getFeature(i), i)) {
+            return;
+        }
+    }
+}
+
 } // namespace mbgl
@@ -5,6 +5,7 @@
 #include <mbgl/util/optional.hpp>
 
 #include <cstdint>
+#include <functional>
 #include <string>
 #include <vector>
 #include <memory>
@@ -12,6 +13,7 @@
 namespace mbgl {
 
 class CanonicalTileID;
+class FlatGeometry;
 
 // Normalized vector tile coordinates.
 // Each geometry coordinate represents a point in a bidimensional space,
@@ -30,6 +32,18 @@ public:
     using std::vector<GeometryCoordinates>::vector;
 };
 
+// A set of property keys resolved against a particular `GeometryTileLayer`, so that the
+// values of all of them can be looked up in a single pass over a feature's properties. See
+// `GeometryTileLayer::resolveKeys` and `GeometryTileFeature::getValues`.
+class ResolvedKeys {
+public:
+    std::vector<std::string> names;
+
+    // For layers that index their keys: maps each layer key index to the position of that
+    // key in `names`, or -1 if it isn't one of them.
+    std::vector<int32_t> slots;
+};
+
 class GeometryTileFeature {
 public:
     virtual ~GeometryTileFeature() = default;
@@ -38,6 +52,14 @@ public:
     virtual PropertyMap getProperties() const { return PropertyMap(); }
     virtual optional<FeatureIdentifier> getID() const { return {}; }
     virtual GeometryCollection getGeometries() const = 0;
+
+    // Like `getGeometries()`, but decodes into `geometry`, reusing the memory that it already
+    // holds where possible.
+    virtual void readGeometries(FlatGeometry& geometry) const;
+
+    // Sets `values[i]` to the value of `keys.names[i]`, or to nothing if the feature doesn't
+    // have that property. `keys` must have been resolved by this feature's layer.
+    virtual void getValues(const ResolvedKeys& keys, std::vector<optional<Value>>& values) const;
 };
 
 class GeometryTileLayer {
@@ -46,13 +68,24 @@ public:
     virtual std::size_t featureCount() const = 0;
     virtual std::unique_ptr<GeometryTileFeature> getFeature(std::size_t) const = 0;
     virtual std::string getName() const = 0;
+    virtual ResolvedKeys resolveKeys(std::vector<std::string> names) const;
+
+    // Calls `visitor` with each feature and its index, in order, for as long as it returns
+    // true. The feature is only valid for the duration of the call, so implementations can
+    // reuse a single feature object rather than allocate one per feature.
+    virtual void eachFeature(const std::function<bool (const GeometryTileFeature&, std::size_t index)>& visitor) const;
 };
 
+// Tile data is immutable, and a single instance is shared by the worker that lays out the
+// tile and the main thread that queries it. Const member functions must therefore be safe
+// to call concurrently.
 class GeometryTileData {
 public:
     virtual ~GeometryTileData() = default;
-    virtual std::unique_ptr<GeometryTileData> clone() const = 0;
     virtual const GeometryTileLayer* getLayer(const std::string&) const = 0;
+
+    // The memory taken up by the encoded data that the layers are read from, if any.
+    virtual std::size_t byteSize() const { return 0; }
 };
 
 // classifies an array of rings into polygons with outer rings and holes
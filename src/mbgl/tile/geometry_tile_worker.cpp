@@ -1,7 +1,13 @@
 #include <mbgl/tile/geometry_tile_worker.hpp>
 #include <mbgl/tile/geometry_tile_data.hpp>
 #include <mbgl/tile/geometry_tile.hpp>
+#include <mbgl/tile/shared_buckets.hpp>
+#include <mbgl/tile/flat_geometry.hpp>
+#include <mbgl/tile/layout_counters.hpp>
+#include <mbgl/actor/fork_join.hpp>
+#include <mbgl/actor/scheduler.hpp>
 #include <mbgl/text/collision_tile.hpp>
+#include <mbgl/geometry/feature_index.hpp>
 #include <mbgl/text/glyph_atlas.hpp>
 #include <mbgl/layout/symbol_layout.hpp>
 #include <mbgl/style/bucket_parameters.hpp>
@@ -13,6 +19,7 @@
 #include <mbgl/util/string.hpp>
 #include <mbgl/util/exception.hpp>
 
+#include <algorithm>
 #include <unordered_set>
 
 namespace mbgl {
@@ -24,13 +31,19 @@ GeometryTileWorker::GeometryTileWorker(ActorRef<GeometryTileWorker> self_,
                                        OverscaledTileID id_,
                                        GlyphAtlas& glyphAtlas_,
                                        const std::atomic<bool>& obsolete_,
-                                       const MapMode mode_)
+                                       const MapMode mode_,
+                                       Scheduler& scheduler_,
+                                       std::size_t parallelLayoutThreshold_,
+                                       LayoutCounters& counters_)
     : self(std::move(self_)),
       parent(std::move(parent_)),
       id(std::move(id_)),
       glyphAtlas(glyphAtlas_),
       obsolete(obsolete_),
-      mode(mode_) {
+      mode(mode_),
+      scheduler(scheduler_),
+      parallelLayoutThreshold(parallelLayoutThreshold_),
+      counters(counters_) {
 }
 
 GeometryTileWorker::~GeometryTileWorker() {
@@ -68,11 +81,28 @@ GeometryTileWorker::~GeometryTileWorker() {
    read all the queued messages until we get to "coalesced", and then redo either
    layout or placement if there were one or more "set"s (with layout taking priority,
    since it will trigger placement when complete), or return to the [idle] state if not.
+
+   Layout is incremental: only buckets named in a `setLayers` message (or not laid out
+   before) are rebuilt, and placement is only redone when a symbol layer was rebuilt or
+   the placement config changed in the meantime. A `setData` message invalidates all
+   buckets. The feature index of a partial layout only covers the rebuilt buckets; the tile
+   adds the entries of the other ones from its previous index.
+
+   When the buckets to rebuild cover at least `parallelLayoutThreshold` features, they are
+   built as separate tasks on the worker scheduler (see `forkJoin`), and the results are
+   merged in layer order, exactly as if they had been built one after another.
+
+   Once the tile is obsolete, layout and placement are abandoned as soon as possible: besides
+   the checks here, bucket creation and `SymbolLayout` check `obsolete` after every feature.
 */
 
-void GeometryTileWorker::setData(std::unique_ptr<const GeometryTileData> data_, uint64_t correlationID_) {
+void GeometryTileWorker::setData(std::shared_ptr<const GeometryTileData> data_,
+                                 SharedBuckets* sharedBuckets_,
+                                 uint64_t correlationID_) {
     try {
         data = std::move(data_);
+        sharedBuckets = sharedBuckets_;
+        dataChanged = true;
         correlationID = correlationID_;
 
         switch (state) {
@@ -92,9 +122,12 @@ void GeometryTileWorker::setData(std::unique_ptr<const GeometryTileData> data_,
     }
 }
 
-void GeometryTileWorker::setLayers(std::vector<std::unique_ptr<Layer>> layers_, uint64_t correlationID_) {
+void GeometryTileWorker::setLayers(std::vector<std::shared_ptr<const Layer>> layers_,
+                                   std::unordered_set<std::string> invalidatedBuckets_,
+                                   uint64_t correlationID_) {
     try {
         layers = std::move(layers_);
+        invalidatedBuckets.insert(invalidatedBuckets_.begin(), invalidatedBuckets_.end());
         correlationID = correlationID_;
 
         switch (state) {
@@ -201,25 +234,56 @@ void GeometryTileWorker::redoLayout() {
         return;
     }
 
-    // We're doing a fresh parse of the tile, because the underlying data or style has changed.
+    // When only some buckets were invalidated, the results of the previous layout are
+    // reused for all other buckets.
+    const bool partial = !dataChanged && laidOut;
+
+    std::unordered_map<std::string, std::unique_ptr<SymbolLayout>> previousSymbolLayouts;
+    for (auto& symbolLayout : symbolLayouts) {
+        previousSymbolLayouts.emplace(symbolLayout->bucketName, std::move(symbolLayout));
+    }
     symbolLayouts.clear();
+    bool symbolLayoutsChanged = !partial;
 
     // We're storing a set of bucket names we've parsed to avoid parsing a bucket twice that is
     // referenced from more than one layer
     std::unordered_set<std::string> parsed;
-    std::unordered_map<std::string, std::unique_ptr<Bucket>> buckets;
-    auto featureIndex = std::make_unique<FeatureIndex>();
-    BucketParameters parameters { id, obsolete, *featureIndex, mode };
+    std::unordered_set<std::string> rebuilt;
+    std::unordered_map<std::string, std::shared_ptr<Bucket>> buckets;
+    auto nextFeatureIndex = std::make_unique<FeatureIndex>();
+
+    // The first pass determines, in layer order, which buckets are reused and which ones have
+    // to be rebuilt. The buckets are then built and merged into the result in that same order.
+    struct BucketLayout {
+        std::shared_ptr<const Layer> layer;
+        bool reused;
+        const GeometryTileLayer* geometryLayer;
+
+        // Set for buckets that are built in parallel, or that can be shared with other tiles,
+        // which are built into their own feature index.
+        std::shared_ptr<FeatureIndex> featureIndex;
+
+        // Set if another tile already built this bucket.
+        optional<SharedBuckets::Entry> shared;
+
+        std::unique_ptr<Bucket> bucket;
+        std::unique_ptr<SymbolLayout> symbolLayout;
+    };
+
+    std::vector<BucketLayout> bucketLayouts;
+    std::vector<std::size_t> tasks;
+    std::size_t featureCount = 0;
 
     for (auto i = layers->rbegin(); i != layers->rend(); i++) {
         if (obsolete) {
+            ++counters.abandoned;
             return;
         }
 
         const Layer* layer = i->get();
         const std::string& bucketName = layer->baseImpl->bucketName();
 
-        featureIndex->addBucketLayerName(bucketName, layer->baseImpl->id);
+        nextFeatureIndex->addBucketLayerName(bucketName, layer->baseImpl->id);
 
         if (parsed.find(bucketName) != parsed.end()) {
             continue;
@@ -227,33 +291,162 @@ void GeometryTileWorker::redoLayout() {
 
         parsed.emplace(bucketName);
 
+        if (partial &&
+            invalidatedBuckets.find(bucketName) == invalidatedBuckets.end() &&
+            parsedBuckets.find(bucketName) != parsedBuckets.end()) {
+            bucketLayouts.push_back({ *i, true, nullptr, nullptr, {}, nullptr, nullptr });
+            continue;
+        }
+
+        rebuilt.emplace(bucketName);
+
         if (!*data) {
             continue; // Tile has no data.
         }
 
+        const bool shareable = sharedBuckets && !layer->is<SymbolLayer>();
+        if (shareable) {
+            if (auto shared = sharedBuckets->find(*i, id)) {
+                bucketLayouts.push_back({ *i, false, nullptr, nullptr, std::move(shared), nullptr, nullptr });
+                continue;
+            }
+        }
+
         auto geometryLayer = (*data)->getLayer(layer->baseImpl->sourceLayer);
         if (!geometryLayer) {
             continue;
         }
 
-        if (layer->is<SymbolLayer>()) {
-            symbolLayouts.push_back(layer->as<SymbolLayer>()->impl->createLayout(parameters, *geometryLayer));
+        tasks.push_back(bucketLayouts.size());
+        featureCount += geometryLayer->featureCount();
+        bucketLayouts.push_back({ *i, false, geometryLayer,
+                                  shareable ? std::make_shared<FeatureIndex>() : nullptr,
+                                  {}, nullptr, nullptr });
+    }
+
+    auto build = [&] (BucketLayout& bucketLayout, FeatureIndex& index, GeometryBuffers& buffers) {
+        BucketParameters parameters { id, obsolete, index, mode, buffers };
+        const Layer& layer = *bucketLayout.layer;
+
+        if (layer.is<SymbolLayer>()) {
+            bucketLayout.symbolLayout = layer.as<SymbolLayer>()->impl->createLayout(parameters, *bucketLayout.geometryLayer);
         } else {
-            std::unique_ptr<Bucket> bucket = layer->baseImpl->createBucket(parameters, *geometryLayer);
-            if (bucket->hasData()) {
-                buckets.emplace(layer->baseImpl->bucketName(), std::move(bucket));
+            bucketLayout.bucket = layer.baseImpl->createBucket(parameters, *bucketLayout.geometryLayer);
+        }
+    };
+
+    // Heavy tiles have their buckets built concurrently, each into its own feature index,
+    // using whichever threads of the worker scheduler are idle.
+    const bool parallel = tasks.size() > 1 && featureCount >= parallelLayoutThreshold;
+
+    // Feature geometry is read into these, one per bucket that is built concurrently. They are
+    // released along with the rest of the layout's scratch space once it is done.
+    std::vector<GeometryBuffers> geometryBuffers(parallel ? tasks.size() : 1);
+
+    if (parallel) {
+        for (std::size_t task : tasks) {
+            if (!bucketLayouts[task].featureIndex) {
+                bucketLayouts[task].featureIndex = std::make_shared<FeatureIndex>();
             }
         }
+
+        // More helpers than threads would only queue up behind each other.
+        const std::size_t helpers = std::max<std::size_t>(1, std::min(scheduler.getConcurrency(), tasks.size()));
+        forkJoin(scheduler, helpers, tasks.size(), [&] (std::size_t i) {
+            if (!obsolete) {
+                BucketLayout& bucketLayout = bucketLayouts[tasks[i]];
+                build(bucketLayout, *bucketLayout.featureIndex, geometryBuffers[i]);
+            }
+        });
     }
 
+    for (auto& bucketLayout : bucketLayouts) {
+        if (obsolete) {
+            ++counters.abandoned;
+            return;
+        }
+
+        const std::string& bucketName = bucketLayout.layer->baseImpl->bucketName();
+
+        if (bucketLayout.reused) {
+            auto it = previousSymbolLayouts.find(bucketName);
+            if (it != previousSymbolLayouts.end()) {
+                symbolLayouts.push_back(std::move(it->second));
+                previousSymbolLayouts.erase(it);
+            }
+            continue;
+        }
+
+        if (bucketLayout.shared) {
+            nextFeatureIndex->insertBucket(*bucketLayout.shared->featureIndex, bucketName);
+            buckets.emplace(bucketName, std::move(bucketLayout.shared->bucket));
+            continue;
+        }
+
+        if (!parallel) {
+            build(bucketLayout,
+                  bucketLayout.featureIndex ? *bucketLayout.featureIndex : *nextFeatureIndex,
+                  geometryBuffers[0]);
+        }
+
+        if (bucketLayout.featureIndex) {
+            nextFeatureIndex->insertBucket(*bucketLayout.featureIndex, bucketName);
+        }
+
+        if (bucketLayout.symbolLayout) {
+            symbolLayouts.push_back(std::move(bucketLayout.symbolLayout));
+            symbolLayoutsChanged = true;
+        } else if (bucketLayout.bucket->hasData()) {
+            std::shared_ptr<Bucket> bucket = std::move(bucketLayout.bucket);
+            if (sharedBuckets && !obsolete) {
+                sharedBuckets->add(bucketLayout.layer, id, { bucket, std::move(bucketLayout.featureIndex) });
+            }
+            buckets.emplace(bucketName, std::move(bucket));
+        }
+    }
+
+    // The last bucket may have been abandoned halfway.
+    if (obsolete) {
+        ++counters.abandoned;
+        return;
+    }
+
+    // Symbol layouts of buckets that were rebuilt or are gone.
+    if (!previousSymbolLayouts.empty()) {
+        symbolLayoutsChanged = true;
+    }
+
+    dataChanged = false;
+    invalidatedBuckets.clear();
+    laidOut = true;
+    parsedBuckets = parsed;
+
+    if (symbolLayoutsChanged) {
+        placedConfig = {};
+    }
+
+    // The previous placement remains valid if it covered the same symbol layouts, and the
+    // placement config didn't change in the meantime.
+    const bool placementValid = placedConfig && placementConfig &&
+                                *placedConfig == *placementConfig &&
+                                !hasPendingSymbolDependencies();
+
+    ++counters.completed;
+
     parent.invoke(&GeometryTile::onLayout, GeometryTile::LayoutResult {
         std::move(buckets),
-        std::move(featureIndex),
-        *data ? (*data)->clone() : nullptr,
+        partial ? optional<std::unordered_set<std::string>>(std::move(rebuilt))
+                : optional<std::unordered_set<std::string>>(),
+        std::move(parsed),
+        std::move(nextFeatureIndex),
+        *data,
+        placementValid,
         correlationID
     });
 
-    attemptPlacement();
+    if (!placementValid) {
+        attemptPlacement();
+    }
 }
 
 bool GeometryTileWorker::hasPendingSymbolDependencies() const {
@@ -278,6 +471,7 @@ void GeometryTileWorker::attemptPlacement() {
     // Prepare as many SymbolLayouts as possible.
     for (auto& symbolLayout : symbolLayouts) {
         if (obsolete) {
+            ++counters.abandoned;
             return;
         }
 
@@ -301,6 +495,7 @@ void GeometryTileWorker::attemptPlacement() {
 
     for (auto& symbolLayout : symbolLayouts) {
         if (obsolete) {
+            ++counters.abandoned;
             return;
         }
 
@@ -311,6 +506,14 @@ void GeometryTileWorker::attemptPlacement() {
         }
     }
 
+    if (obsolete) {
+        ++counters.abandoned;
+        return;
+    }
+
+    placedConfig = placementConfig;
+    ++counters.completed;
+
     parent.invoke(&GeometryTile::onPlacement, GeometryTile::PlacementResult {
         std::move(buckets),
         std::move(collisionTile),
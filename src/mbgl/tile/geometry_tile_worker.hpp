@@ -8,14 +8,20 @@
 
 #include <atomic>
 #include <memory>
+#include <string>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace mbgl {
 
 class GeometryTile;
 class GeometryTileData;
+class FeatureIndex;
 class GlyphAtlas;
+class LayoutCounters;
+class Scheduler;
 class SymbolLayout;
+class SharedBuckets;
 
 namespace style {
 class Layer;
@@ -28,11 +34,20 @@ public:
                        OverscaledTileID,
                        GlyphAtlas&,
                        const std::atomic<bool>&,
-                       const MapMode);
+                       const MapMode,
+                       Scheduler&,
+                       std::size_t parallelLayoutThreshold,
+                       LayoutCounters&);
     ~GeometryTileWorker();
 
-    void setLayers(std::vector<std::unique_ptr<style::Layer>>, uint64_t correlationID);
-    void setData(std::unique_ptr<const GeometryTileData>, uint64_t correlationID);
+    void setLayers(std::vector<std::shared_ptr<const style::Layer>>,
+                   std::unordered_set<std::string> invalidatedBuckets,
+                   uint64_t correlationID);
+    // The shared buckets, if any, are owned by the tile, which keeps them alive for as long as
+    // the worker may refer to them.
+    void setData(std::shared_ptr<const GeometryTileData>,
+                 SharedBuckets*,
+                 uint64_t correlationID);
     void setPlacementConfig(PlacementConfig, uint64_t correlationID);
     void symbolDependenciesChanged();
 
@@ -50,6 +65,11 @@ private:
     GlyphAtlas& glyphAtlas;
     const std::atomic<bool>& obsolete;
     const MapMode mode;
+    Scheduler& scheduler;
+    const std::size_t parallelLayoutThreshold;
+
+    // Shared by the workers of all tiles of the style.
+    LayoutCounters& counters;
 
     enum State {
         Idle,
@@ -62,11 +82,26 @@ private:
     uint64_t correlationID = 0;
 
     // Outer optional indicates whether we've received it or not.
-    optional<std::vector<std::unique_ptr<style::Layer>>> layers;
-    optional<std::unique_ptr<const GeometryTileData>> data;
+    optional<std::vector<std::shared_ptr<const style::Layer>>> layers;
+    optional<std::shared_ptr<const GeometryTileData>> data;
+
+    // Buckets shared with the other tiles of the same canonical tile, if any.
+    SharedBuckets* sharedBuckets = nullptr;
     optional<PlacementConfig> placementConfig;
 
     std::vector<std::unique_ptr<SymbolLayout>> symbolLayouts;
+
+    // Buckets that need to be rebuilt by the next layout. All other buckets that were part of
+    // the previous layout are reused as they are, unless the data changed.
+    bool dataChanged = true;
+    std::unordered_set<std::string> invalidatedBuckets;
+
+    // Results of the previous layout that are reused by the next one. The feature index entries
+    // of reused buckets are kept by the tile only, which completes the index of a partial
+    // layout with them.
+    bool laidOut = false;
+    std::unordered_set<std::string> parsedBuckets;
+    optional<PlacementConfig> placedConfig;
 };
 
 } // namespace mbgl
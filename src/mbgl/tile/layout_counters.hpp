@@ -0,0 +1,22 @@
+#pragma once
+
+#include <mbgl/util/layout_statistics.hpp>
+
+#include <atomic>
+#include <cstddef>
+
+namespace mbgl {
+
+// Counts the layouts and placements of the tiles of one style. The workers of its tiles
+// update the counts concurrently, so they must not outlive it.
+class LayoutCounters {
+public:
+    std::atomic<std::size_t> completed { 0 };
+    std::atomic<std::size_t> abandoned { 0 };
+
+    LayoutStatistics get() const {
+        return { completed, abandoned };
+    }
+};
+
+} // namespace mbgl
@@ -31,12 +31,12 @@ void RasterTile::setError(std::exception_ptr err) {
     observer->onTileError(*this, err);
 }
 
-void RasterTile::setData(std::shared_ptr<const std::string> data,
+void RasterTile::setData(ByteBuffer data,
                              optional<Timestamp> modified_,
                              optional<Timestamp> expires_) {
     modified = modified_;
     expires = expires_;
-    worker.invoke(&RasterTileWorker::parse, data);
+    worker.invoke(&RasterTileWorker::parse, std::move(data));
 }
 
 void RasterTile::onParsed(std::unique_ptr<Bucket> result) {
@@ -55,7 +55,19 @@ Bucket* RasterTile::getBucket(const style::Layer&) {
     return bucket.get();
 }
 
+MemoryUsage RasterTile::getMemoryUsage() const {
+    return bucket ? bucket->getMemoryUsage() : MemoryUsage();
+}
+
+void RasterTile::releaseGPUResources() {
+    if (bucket) {
+        bucket->releaseGPUResources();
+    }
+}
+
 void RasterTile::setNecessity(Necessity necessity) {
+    worker.setPriority(necessity == Necessity::Required ? Mailbox::Priority::High
+                                                        : Mailbox::Priority::Low);
     loader.setNecessity(necessity);
 }
 
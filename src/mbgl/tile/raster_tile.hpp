@@ -24,12 +24,14 @@ public:
     void setNecessity(Necessity) final;
 
     void setError(std::exception_ptr);
-    void setData(std::shared_ptr<const std::string> data,
+    void setData(ByteBuffer data,
                  optional<Timestamp> modified_,
                  optional<Timestamp> expires_);
 
     void cancel() override;
     Bucket* getBucket(const style::Layer&) override;
+    MemoryUsage getMemoryUsage() const override;
+    void releaseGPUResources() override;
 
     void onParsed(std::unique_ptr<Bucket> result);
     void onError(std::exception_ptr);
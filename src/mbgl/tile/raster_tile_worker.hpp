@@ -1,9 +1,7 @@
 #pragma once
 
 #include <mbgl/actor/actor_ref.hpp>
-
-#include <memory>
-#include <string>
+#include <mbgl/util/byte_buffer.hpp>
 
 namespace mbgl {
 
@@ -13,7 +11,7 @@ class RasterTileWorker {
 public:
     RasterTileWorker(ActorRef<RasterTileWorker>, ActorRef<RasterTile>);
 
-    void parse(std::shared_ptr<const std::string> data);
+    void parse(ByteBuffer data);
 
 private:
     ActorRef<RasterTile> parent;
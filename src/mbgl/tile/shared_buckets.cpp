@@ -0,0 +1,58 @@
+#include <mbgl/tile/shared_buckets.hpp>
+#include <mbgl/style/layer.hpp>
+#include <mbgl/style/layer_impl.hpp>
+
+#include <algorithm>
+#include <iterator>
+
+namespace mbgl {
+
+optional<SharedBuckets::Entry> SharedBuckets::find(const std::shared_ptr<const style::Layer>& layer,
+                                                   const OverscaledTileID& id) const {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    for (const auto& entry : built) {
+        if (entry.layer.lock() == layer && layer->baseImpl->canShareBucket(entry.tileID, id)) {
+            return Entry { entry.bucket, entry.featureIndex };
+        }
+    }
+
+    return {};
+}
+
+void SharedBuckets::add(const std::shared_ptr<const style::Layer>& layer,
+                        const OverscaledTileID& id,
+                        Entry entry) {
+    std::lock_guard<std::mutex> lock(mutex);
+    built.push_back({ layer, id, std::move(entry.bucket), std::move(entry.featureIndex) });
+}
+
+void SharedBuckets::prune() {
+    std::vector<Built> outdated;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        // Buckets are only copied out of `built` under the lock, so one that is referenced from
+        // here alone can't be picked up concurrently.
+        auto it = std::stable_partition(built.begin(), built.end(), [] (const Built& b) {
+            return !b.layer.expired() && b.bucket.use_count() > 1;
+        });
+        std::move(it, built.end(), std::back_inserter(outdated));
+        built.erase(it, built.end());
+    }
+    // The buckets are released here, outside of the lock.
+}
+
+std::size_t SharedBuckets::useCount(const std::shared_ptr<Bucket>& bucket) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    const bool held = std::any_of(built.begin(), built.end(), [&] (const Built& b) {
+        return b.bucket == bucket;
+    });
+    return bucket.use_count() - (held ? 1 : 0);
+}
+
+std::size_t SharedBuckets::size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return built.size();
+}
+
+} // namespace mbgl
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <mbgl/tile/tile_id.hpp>
+#include <mbgl/util/optional.hpp>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace mbgl {
+
+class Bucket;
+class FeatureIndex;
+
+namespace style {
+class Layer;
+} // namespace style
+
+/*
+    Buckets that the tiles of one canonical tile share. Past a source's maxzoom, the fill, line
+    and circle buckets of every overscaled tile are built from the same data, and usually come
+    out the same. The first tile to build such a bucket adds it here, and tiles overscaled
+    further pick it up instead of tessellating the same geometry again. Only symbol layout and
+    placement then happen for every zoom level.
+
+    A bucket is shared along with the feature index entries that were created with it. Entries
+    refer to the layer snapshot they were built from, so that a change to the layer's layout or
+    filter, which produces a new snapshot, stops them from being reused.
+
+    Tiles use this from their workers, so it is safe to use from several threads at once. Once
+    shared, buckets are only handled on the main thread, where they are uploaded. The tiles
+    that own this object hold on to it there, and only `prune` releases buckets, so they are
+    also released there rather than by a worker that drops a layout result. A worker can't
+    lose a bucket that it found to `prune` either, as it holds on to the layer snapshot.
+*/
+class SharedBuckets {
+public:
+    class Entry {
+    public:
+        std::shared_ptr<Bucket> bucket;
+        std::shared_ptr<const FeatureIndex> featureIndex;
+    };
+
+    // Returns a bucket for `layer` that tile `id` can use, if there is one.
+    optional<Entry> find(const std::shared_ptr<const style::Layer>& layer, const OverscaledTileID& id) const;
+
+    // Offers the bucket that tile `id` built for `layer` to the other tiles.
+    void add(const std::shared_ptr<const style::Layer>& layer, const OverscaledTileID& id, Entry);
+
+    // Releases the buckets that were built from outdated snapshots of a layer, and those that
+    // no tile uses anymore, such as the ones built for a zoom level that is no longer shown.
+    // Tiles call this whenever their buckets change. Only call this on the main thread.
+    void prune();
+
+    // The number of tiles that use `bucket`. The reference that is kept here doesn't count.
+    std::size_t useCount(const std::shared_ptr<Bucket>& bucket) const;
+
+    std::size_t size() const;
+
+private:
+    class Built {
+    public:
+        std::weak_ptr<const style::Layer> layer;
+        OverscaledTileID tileID;
+        std::shared_ptr<Bucket> bucket;
+        std::shared_ptr<const FeatureIndex> featureIndex;
+    };
+
+    mutable std::mutex mutex;
+    std::vector<Built> built;
+};
+
+} // namespace mbgl
@@ -14,6 +14,7 @@
 #include <memory>
 #include <functional>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace mbgl {
 
@@ -47,9 +48,24 @@ public:
 
     virtual Bucket* getBucket(const style::Layer&) = 0;
 
+    // The memory held by the tile's data, buckets and feature index. Data and buckets that
+    // the tile shares with other tiles count in full towards each of them.
+    virtual MemoryUsage getMemoryUsage() const { return {}; }
+
+    // Frees the GPU copies of the tile's buckets. They are uploaded again when the tile is
+    // next rendered.
+    virtual void releaseGPUResources() {}
+
+    // Frees what the tile only needs for `queryRenderedFeatures`, for tiles in the TileCache.
+    // It is recreated when the tile is retained again.
+    virtual void releaseFeatureIndex() {}
+
     virtual void setPlacementConfig(const PlacementConfig&) {}
     virtual void symbolDependenciesChanged() {};
-    virtual void redoLayout() {}
+
+    // Re-run layout for the buckets with the given names, reusing the results of the
+    // previous layout for all other buckets.
+    virtual void redoLayout(const std::unordered_set<std::string>&) {}
 
     virtual void queryRenderedFeatures(
             std::unordered_map<std::string, std::vector<Feature>>& result,
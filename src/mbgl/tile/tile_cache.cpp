@@ -5,62 +5,132 @@
 
 namespace mbgl {
 
-void TileCache::setSize(size_t size_) {
+TileCache::~TileCache() {
+    clear();
+}
+
+void TileCache::setManager(TileMemoryManager* manager_) {
+    clear();
+    manager = manager_;
+}
+
+void TileCache::setSize(std::size_t size_) {
     size = size_;
 
-    while (orderedKeys.size() > size) {
-        auto key = orderedKeys.front();
-        orderedKeys.pop_front();
-        tiles.erase(key);
+    while (entries.size() > size) {
+        evict(entries.front().key);
+    }
+}
+
+void TileCache::releaseMemory() {
+    for (auto& entry : entries) {
+        entry.tile->releaseGPUResources();
+        entry.tile->releaseFeatureIndex();
+        entry.gpuReleased = true;
+
+        const MemoryUsage tileUsage = entry.tile->getMemoryUsage();
+        manager->resize(entry.handle, tileUsage.total());
+        usage -= entry.usage;
+        usage += tileUsage;
+        entry.usage = tileUsage;
     }
+}
 
-    assert(orderedKeys.size() <= size);
+void TileCache::invalidateBuckets(const std::unordered_set<std::string>& bucketNames) {
+    for (auto& entry : entries) {
+        entry.invalidatedBuckets.insert(bucketNames.begin(), bucketNames.end());
+    }
 }
 
 void TileCache::add(const OverscaledTileID& key, std::unique_ptr<Tile> tile) {
-    if (!tile->isRenderable() || !size) {
+    if (!tile->isRenderable() || !size || !manager) {
         return;
     }
 
-    // insert new or query existing tile
-    if (tiles.emplace(key, std::move(tile)).second) {
-        // remove existing tile key
-        orderedKeys.remove(key);
-    }
+    // Replace an existing tile, and make the key the newest.
+    evict(key);
 
-    // (re-)insert tile key as newest
-    orderedKeys.push_back(key);
+    const MemoryUsage tileUsage = tile->getMemoryUsage();
+    entries.push_back({ key, std::move(tile), tileUsage, manager->add(*this, key, tileUsage.total()), false, {} });
+    index.emplace(key, std::prev(entries.end()));
+    usage += tileUsage;
 
-    // purge oldest key/tile if necessary
-    if (orderedKeys.size() > size) {
-        get(orderedKeys.front());
+    if (entries.size() > size) {
+        evict(entries.front().key);
     }
 
-    assert(orderedKeys.size() <= size);
+    // This may evict tiles of other caches, or the one that was just added.
+    manager->evict();
+
+    assert(entries.size() == index.size());
 }
 
 std::unique_ptr<Tile> TileCache::get(const OverscaledTileID& key) {
-
     std::unique_ptr<Tile> tile;
 
-    auto it = tiles.find(key);
-    if (it != tiles.end()) {
-        tile = std::move(it->second);
-        tiles.erase(it);
-        orderedKeys.remove(key);
+    auto it = index.find(key);
+    if (it != index.end()) {
+        manager->remove(it->second->handle);
+        tile = std::move(it->second->tile);
+        std::unordered_set<std::string> invalidatedBuckets = std::move(it->second->invalidatedBuckets);
+        drop(key);
         assert(tile->isRenderable());
+
+        if (!invalidatedBuckets.empty()) {
+            tile->redoLayout(invalidatedBuckets);
+        }
     }
 
     return tile;
 }
 
+void TileCache::evict(const OverscaledTileID& key) {
+    auto it = index.find(key);
+    if (it != index.end()) {
+        manager->remove(it->second->handle);
+        drop(key);
+    }
+}
+
 bool TileCache::has(const OverscaledTileID& key) {
-    return tiles.find(key) != tiles.end();
+    return index.find(key) != index.end();
 }
 
 void TileCache::clear() {
-    orderedKeys.clear();
-    tiles.clear();
+    for (const auto& entry : entries) {
+        manager->remove(entry.handle);
+    }
+    index.clear();
+    entries.clear();
+    usage = {};
+}
+
+std::size_t TileCache::releaseGPUResources(const OverscaledTileID& key) {
+    auto it = index.find(key);
+    assert(it != index.end());
+    Entry& entry = *it->second;
+    if (entry.gpuReleased || !entry.usage.gpu) {
+        return 0;
+    }
+
+    entry.tile->releaseGPUResources();
+    entry.gpuReleased = true;
+
+    const MemoryUsage tileUsage = entry.tile->getMemoryUsage();
+    const std::size_t freed = entry.usage.gpu - tileUsage.gpu;
+    manager->resize(entry.handle, tileUsage.total());
+    usage -= entry.usage;
+    usage += tileUsage;
+    entry.usage = tileUsage;
+    return freed;
+}
+
+void TileCache::drop(const OverscaledTileID& key) {
+    auto it = index.find(key);
+    assert(it != index.end());
+    usage -= it->second->usage;
+    entries.erase(it->second);
+    index.erase(it);
 }
 
 } // namespace mbgl
@@ -1,31 +1,94 @@
 #pragma once
 
 #include <mbgl/tile/tile_id.hpp>
+#include <mbgl/tile/tile_memory_manager.hpp>
+#include <mbgl/util/memory_usage.hpp>
 
+#include <cstddef>
+#include <limits>
 #include <list>
 #include <memory>
-#include <map>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace mbgl {
 
 class Tile;
 
+/*
+    Keeps recently used tiles of a source that are no longer displayed, so that they can be
+    shown again without reloading them.
+
+    Tiles are only cached while the cache is registered with a `TileMemoryManager`, which
+    evicts tiles across all caches to stay within its memory budget. On top of that, the
+    least recently added tiles are evicted once the cache holds more than `getSize()` tiles.
+
+    Cached tiles keep their layout when the style changes. The buckets that the change
+    invalidated are recorded for each tile instead, and laid out again once `get` hands the
+    tile back out, so that tiles which are evicted before they are used again cost nothing.
+
+    A tile's memory usage is taken when it is added, and again by `releaseMemory`.
+    `invalidateBuckets` visits every tile. All other operations take constant time.
+*/
 class TileCache {
 public:
-    TileCache(size_t size_ = 0) : size(size_) {}
+    TileCache() = default;
+    ~TileCache();
+
+    // Drops all cached tiles.
+    void setManager(TileMemoryManager*);
+
+    // The maximum number of tiles; unlimited by default.
+    void setSize(std::size_t);
+    std::size_t getSize() const { return size; }
+
+    // The memory taken up by the cached tiles.
+    MemoryUsage getMemoryUsage() const { return usage; }
+
+    // Lets the cached tiles free whatever they can recreate when they are used again.
+    void releaseMemory();
+
+    // Has the cached tiles lay out the buckets with the given names again when they are
+    // retrieved.
+    void invalidateBuckets(const std::unordered_set<std::string>&);
 
-    void setSize(size_t);
-    size_t getSize() const { return size; };
     void add(const OverscaledTileID& key, std::unique_ptr<Tile> data);
     std::unique_ptr<Tile> get(const OverscaledTileID& key);
     bool has(const OverscaledTileID& key);
     void clear();
 
 private:
-    std::map<OverscaledTileID, std::unique_ptr<Tile>> tiles;
-    std::list<OverscaledTileID> orderedKeys;
+    friend class TileMemoryManager;
+
+    struct Entry {
+        OverscaledTileID key;
+        std::unique_ptr<Tile> tile;
+        MemoryUsage usage;
+        TileMemoryManager::Handle handle;
+        bool gpuReleased = false;
+        std::unordered_set<std::string> invalidatedBuckets;
+    };
+
+    // Discards a tile without handing it out.
+    void evict(const OverscaledTileID&);
+
+    // Removes a tile that the manager has already removed on its side.
+    void drop(const OverscaledTileID&);
+
+    // Returns the GPU memory that the tile freed. A tile only releases its GPU resources once
+    // while it is cached: buckets that it shares with displayed tiles keep theirs, and trying
+    // again every frame would free nothing more.
+    std::size_t releaseGPUResources(const OverscaledTileID&);
+
+    TileMemoryManager* manager = nullptr;
+
+    // Oldest first.
+    std::list<Entry> entries;
+    std::unordered_map<OverscaledTileID, std::list<Entry>::iterator> index;
 
-    size_t size;
+    std::size_t size = std::numeric_limits<std::size_t>::max();
+    MemoryUsage usage;
 };
 
 } // namespace mbgl
@@ -0,0 +1,52 @@
+#include <mbgl/tile/tile_memory_manager.hpp>
+#include <mbgl/tile/tile_cache.hpp>
+
+#include <cassert>
+
+namespace mbgl {
+
+TileMemoryManager::~TileMemoryManager() {
+    assert(entries.empty());
+}
+
+void TileMemoryManager::setMaxBytes(std::size_t maxBytes_) {
+    maxBytes = maxBytes_;
+    evict();
+}
+
+TileMemoryManager::Handle TileMemoryManager::add(TileCache& cache, const OverscaledTileID& key, std::size_t tileBytes) {
+    bytes += tileBytes;
+    return entries.insert(entries.end(), { &cache, key, tileBytes });
+}
+
+void TileMemoryManager::remove(Handle handle) {
+    bytes -= handle->bytes;
+    entries.erase(handle);
+}
+
+void TileMemoryManager::resize(Handle handle, std::size_t tileBytes) {
+    bytes = bytes - handle->bytes + tileBytes;
+    handle->bytes = tileBytes;
+}
+
+void TileMemoryManager::evict() {
+    trim(maxBytes);
+}
+
+std::size_t TileMemoryManager::releaseGPUResources(std::size_t gpuBytes) {
+    std::size_t freed = 0;
+    for (auto it = entries.begin(); it != entries.end() && freed < gpuBytes; ++it) {
+        freed += it->cache->releaseGPUResources(it->key);
+    }
+    return freed;
+}
+
+void TileMemoryManager::trim(std::size_t targetBytes) {
+    while (bytes > targetBytes && !entries.empty()) {
+        const Entry entry = entries.front();
+        remove(entries.begin());
+        entry.cache->drop(entry.key);
+    }
+}
+
+} // namespace mbgl
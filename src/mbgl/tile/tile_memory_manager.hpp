@@ -0,0 +1,70 @@
+#pragma once
+
+#include <mbgl/tile/tile_id.hpp>
+#include <mbgl/util/constants.hpp>
+
+#include <cstddef>
+#include <list>
+
+namespace mbgl {
+
+class TileCache;
+
+/*
+    Enforces one memory budget for the tile caches of all sources of a style. The cached
+    tiles of all sources are kept in a single LRU order, so that the least recently cached
+    tile is evicted first, regardless of the source it belongs to.
+
+    Caches register with a manager through `TileCache::setManager`, and must unregister before
+    the manager is destroyed.
+*/
+class TileMemoryManager {
+public:
+    explicit TileMemoryManager(std::size_t maxBytes_ = util::DEFAULT_TILE_CACHE_BYTES)
+        : maxBytes(maxBytes_) {}
+
+    ~TileMemoryManager();
+
+    void setMaxBytes(std::size_t);
+    std::size_t getMaxBytes() const { return maxBytes; }
+
+    // The combined CPU and GPU memory of the tiles in all registered caches.
+    std::size_t getBytes() const { return bytes; }
+
+    // Evicts the least recently cached tiles until no more than `targetBytes` remain, without
+    // changing the budget.
+    void trim(std::size_t targetBytes);
+
+    // Makes the least recently cached tiles release their GPU resources until at least
+    // `gpuBytes` are freed, or no cached tile holds any. Returns the number of bytes freed.
+    std::size_t releaseGPUResources(std::size_t gpuBytes);
+
+private:
+    friend class TileCache;
+
+    struct Entry {
+        TileCache* cache;
+        OverscaledTileID key;
+        std::size_t bytes;
+    };
+
+    using Handle = std::list<Entry>::iterator;
+
+    // Adds a tile as the most recently cached one, without evicting anything yet.
+    Handle add(TileCache&, const OverscaledTileID&, std::size_t bytes);
+    void remove(Handle);
+
+    // Updates the size of a tile whose memory usage changed while it was cached.
+    void resize(Handle, std::size_t bytes);
+
+    // Evicts the least recently cached tiles until the budget is met.
+    void evict();
+
+    // Least recently cached first.
+    std::list<Entry> entries;
+
+    std::size_t maxBytes;
+    std::size_t bytes = 0;
+};
+
+} // namespace mbgl
@@ -2,10 +2,12 @@
 
 #include <mbgl/tile/geometry_tile.hpp>
 #include <mbgl/tile/tile_loader.hpp>
+#include <mbgl/util/byte_buffer.hpp>
 
 namespace mbgl {
 
 class Tileset;
+class VectorTileDataCache;
 
 namespace style {
 class UpdateParameters;
@@ -16,14 +18,16 @@ public:
     VectorTile(const OverscaledTileID&,
                std::string sourceID,
                const style::UpdateParameters&,
-               const Tileset&);
+               const Tileset&,
+               VectorTileDataCache&);
 
     void setNecessity(Necessity) final;
-    void setData(std::shared_ptr<const std::string> data,
+    void setData(ByteBuffer data,
                  optional<Timestamp> modified,
                  optional<Timestamp> expires);
 
 private:
+    VectorTileDataCache& dataCache;
     TileLoader<VectorTile> loader;
 };
 
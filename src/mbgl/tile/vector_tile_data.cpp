@@ -0,0 +1,370 @@
+#include <mbgl/tile/vector_tile_data.hpp>
+#include <mbgl/tile/flat_geometry.hpp>
+#include <mbgl/util/compression.hpp>
+#include <mbgl/util/constants.hpp>
+
+#include <cmath>
+
+namespace mbgl {
+
+static Value parseValue(protozero::pbf_reader data) {
+    while (data.next())
+    {
+        switch (data.tag()) {
+        case 1: // string_value
+            return data.get_string();
+        case 2: // float_value
+            return static_cast<double>(data.get_float());
+        case 3: // double_value
+            return data.get_double();
+        case 4: // int_value
+            return data.get_int64();
+        case 5: // uint_value
+            return data.get_uint64();
+        case 6: // sint_value
+            return data.get_sint64();
+        case 7: // bool_value
+            return data.get_bool();
+        default:
+            data.skip();
+            break;
+        }
+    }
+    return false;
+}
+
+VectorTileFeature::VectorTileFeature(protozero::pbf_reader feature_pbf, const VectorTileLayer& layer_)
+    : layer(layer_) {
+    load(std::move(feature_pbf));
+}
+
+void VectorTileFeature::load(protozero::pbf_reader feature_pbf) {
+    id = optional<FeatureIdentifier>();
+    type = FeatureType::Unknown;
+    tags_iter = packed_iter_type();
+    geometryBegin = nullptr;
+    geometryEnd = nullptr;
+
+    while (feature_pbf.next()) {
+        switch (feature_pbf.tag()) {
+        case 1: // id
+            id = { feature_pbf.get_uint64() };
+            break;
+        case 2: // tags
+            tags_iter = feature_pbf.get_packed_uint32();
+            break;
+        case 3: // type
+            type = static_cast<FeatureType>(feature_pbf.get_enum());
+            break;
+        case 4: { // geometry
+            const auto data = feature_pbf.get_data();
+            geometryBegin = data.first;
+            geometryEnd = data.first + data.second;
+            break;
+        }
+        default:
+            feature_pbf.skip();
+            break;
+        }
+    }
+}
+
+optional<Value> VectorTileFeature::getValue(const std::string& key) const {
+    auto keyIter = layer.keysMap.find(key);
+    if (keyIter == layer.keysMap.end()) {
+        return optional<Value>();
+    }
+
+    auto start_itr = tags_iter.begin();
+    const auto & end_itr = tags_iter.end();
+    while (start_itr != end_itr) {
+        uint32_t tag_key = static_cast<uint32_t>(*start_itr++);
+
+        if (layer.keysMap.size() <= tag_key) {
+            throw std::runtime_error("feature referenced out of range key");
+        }
+
+        if (start_itr == end_itr) {
+            throw std::runtime_error("uneven number of feature tag ids");
+        }
+
+        uint32_t tag_val = static_cast<uint32_t>(*start_itr++);;
+        if (layer.encodedValues.size() <= tag_val) {
+            throw std::runtime_error("feature referenced out of range value");
+        }
+
+        if (tag_key == keyIter->second) {
+            return layer.getValues()[tag_val];
+        }
+    }
+
+    return optional<Value>();
+}
+
+std::unordered_map<std::string,Value> VectorTileFeature::getProperties() const {
+    std::unordered_map<std::string,Value> properties;
+    const std::vector<Value>& values = layer.getValues();
+    auto start_itr = tags_iter.begin();
+    const auto & end_itr = tags_iter.end();
+    while (start_itr != end_itr) {
+        uint32_t tag_key = static_cast<uint32_t>(*start_itr++);
+        if (start_itr == end_itr) {
+            throw std::runtime_error("uneven number of feature tag ids");
+        }
+        uint32_t tag_val = static_cast<uint32_t>(*start_itr++);
+        properties[layer.keys.at(tag_key)] = values.at(tag_val);
+    }
+    return properties;
+}
+
+void VectorTileFeature::getValues(const ResolvedKeys& keys, std::vector<optional<Value>>& values) const {
+    values.assign(keys.names.size(), optional<Value>());
+
+    auto start_itr = tags_iter.begin();
+    const auto & end_itr = tags_iter.end();
+    while (start_itr != end_itr) {
+        uint32_t tag_key = static_cast<uint32_t>(*start_itr++);
+        if (start_itr == end_itr) {
+            throw std::runtime_error("uneven number of feature tag ids");
+        }
+        uint32_t tag_val = static_cast<uint32_t>(*start_itr++);
+
+        if (tag_key >= keys.slots.size() || keys.slots[tag_key] < 0) {
+            continue;
+        }
+
+        values[keys.slots[tag_key]] = layer.getValues().at(tag_val);
+    }
+}
+
+optional<FeatureIdentifier> VectorTileFeature::getID() const {
+    return id;
+}
+
+GeometryCollection VectorTileFeature::getGeometries() const {
+    FlatGeometry geometry;
+    readGeometries(geometry);
+    return geometry.toCollection();
+}
+
+namespace {
+
+// Most of the values in a geometry are small coordinate deltas and command integers that fit
+// in a single varint byte, so those skip the general decoder.
+inline uint32_t decodeVarint(const char*& data, const char* end) {
+    if (data != end && static_cast<uint8_t>(*data) < 0x80) {
+        return static_cast<uint8_t>(*data++);
+    }
+    return static_cast<uint32_t>(protozero::decode_varint(&data, end));
+}
+
+// Scales layer coordinates to `util::EXTENT`. Tiles almost always use an extent that divides
+// it, which makes the rounding exact and lets the common cases avoid floating point.
+struct NoScale {
+    int16_t operator()(int32_t value) const {
+        return static_cast<int16_t>(value);
+    }
+};
+
+struct IntegerScale {
+    int32_t factor;
+    int16_t operator()(int32_t value) const {
+        return static_cast<int16_t>(value * factor);
+    }
+};
+
+struct FloatScale {
+    float scale;
+    int16_t operator()(int32_t value) const {
+        return static_cast<int16_t>(::round(value * scale));
+    }
+};
+
+template <class Scale>
+void decodeGeometry(const char* data, const char* end, Scale scale, FlatGeometry& geometry) {
+    uint8_t cmd = 1;
+    uint32_t length = 0;
+    int32_t x = 0;
+    int32_t y = 0;
+
+    geometry.clear();
+    geometry.beginRing();
+    std::size_t linePoints = 0;
+
+    while (data != end) {
+        if (length == 0) {
+            uint32_t cmd_length = decodeVarint(data, end);
+            cmd = cmd_length & 0x7;
+            length = cmd_length >> 3;
+        }
+
+        --length;
+
+        if (cmd == 1 || cmd == 2) {
+            x += protozero::decode_zigzag32(decodeVarint(data, end));
+            y += protozero::decode_zigzag32(decodeVarint(data, end));
+
+            if (cmd == 1 && linePoints > 0) { // moveTo
+                geometry.beginRing();
+                linePoints = 0;
+            }
+
+            geometry.addPoint({ scale(x), scale(y) });
+            ++linePoints;
+
+        } else if (cmd == 7) { // closePolygon
+            if (linePoints > 0) {
+                const GeometryCoordinate first = geometry.ring(geometry.ringCount() - 1).front();
+                geometry.addPoint(first);
+                ++linePoints;
+            }
+
+        } else {
+            throw std::runtime_error("unknown command");
+        }
+    }
+}
+
+} // namespace
+
+void VectorTileFeature::readGeometries(FlatGeometry& geometry) const {
+    const uint32_t extent = util::EXTENT;
+
+    if (layer.extent == extent) {
+        decodeGeometry(geometryBegin, geometryEnd, NoScale(), geometry);
+    } else if (layer.extent != 0 && extent % layer.extent == 0) {
+        decodeGeometry(geometryBegin, geometryEnd,
+                       IntegerScale { static_cast<int32_t>(extent / layer.extent) }, geometry);
+    } else {
+        decodeGeometry(geometryBegin, geometryEnd,
+                       FloatScale { float(util::EXTENT) / layer.extent }, geometry);
+    }
+
+    if (layer.version >= 2 || type != FeatureType::Polygon) {
+        return;
+    }
+
+    geometry.assign(fixupPolygons(geometry.toCollection()));
+}
+
+VectorTileData::VectorTileData(ByteBuffer data_)
+    : data(std::move(data_)) {
+}
+
+std::size_t VectorTileData::byteSize() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return data.size() + inflated.size();
+}
+
+const GeometryTileLayer* VectorTileData::getLayer(const std::string& name) const {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (!indexed) {
+        protozero::pbf_reader tile_pbf(data.data(), data.size());
+        if (util::isCompressed(data.data(), data.size())) {
+            inflated = util::decompress(data.data(), data.size());
+            tile_pbf = protozero::pbf_reader(inflated);
+        }
+
+        while (tile_pbf.next(3)) {
+            protozero::pbf_reader layer_pbf = tile_pbf.get_message();
+            protozero::pbf_reader name_pbf = layer_pbf;
+            if (name_pbf.next(1)) { // name
+                layers.emplace(name_pbf.get_string(), Layer { layer_pbf, nullptr });
+            }
+        }
+        indexed = true;
+    }
+
+    auto it = layers.find(name);
+    if (it == layers.end()) {
+        return nullptr;
+    }
+
+    if (!it->second.decoded) {
+        it->second.decoded = std::make_unique<VectorTileLayer>(it->second.message);
+    }
+    return it->second.decoded.get();
+}
+
+VectorTileLayer::VectorTileLayer(protozero::pbf_reader layer_pbf) {
+    while (layer_pbf.next()) {
+        switch (layer_pbf.tag()) {
+        case 1: // name
+            name = layer_pbf.get_string();
+            break;
+        case 2: // feature
+            features.push_back(layer_pbf.get_message());
+            break;
+        case 3: // keys
+            {
+                auto iter = keysMap.emplace(layer_pbf.get_string(), keysMap.size());
+                keys.emplace_back(std::reference_wrapper<const std::string>(iter.first->first));
+            }
+            break;
+        case 4: // values
+            encodedValues.push_back(layer_pbf.get_message());
+            break;
+        case 5: // extent
+            extent = layer_pbf.get_uint32();
+            break;
+        case 15: // version
+            version = layer_pbf.get_uint32();
+            break;
+        default:
+            layer_pbf.skip();
+            break;
+        }
+    }
+}
+
+const std::vector<Value>& VectorTileLayer::getValues() const {
+    if (!valuesDecoded) {
+        std::lock_guard<std::mutex> lock(valuesMutex);
+        if (!valuesDecoded) {
+            values.reserve(encodedValues.size());
+            for (const auto& value : encodedValues) {
+                values.emplace_back(parseValue(value));
+            }
+            valuesDecoded = true;
+        }
+    }
+    return values;
+}
+
+std::unique_ptr<GeometryTileFeature> VectorTileLayer::getFeature(std::size_t i) const {
+    return std::make_unique<VectorTileFeature>(features.at(i), *this);
+}
+
+void VectorTileLayer::eachFeature(const std::function<bool (const GeometryTileFeature&, std::size_t)>& visitor) const {
+    if (features.empty()) {
+        return;
+    }
+
+    VectorTileFeature feature(features[0], *this);
+    for (std::size_t i = 0; i < features.size(); ++i) {
+        if (i > 0) {
+            feature.load(features[i]);
+        }
+        if (!visitor(feature, i)) {
+            return;
+        }
+    }
+}
+
+std::string VectorTileLayer::getName() const {
+    return name;
+}
+
+ResolvedKeys VectorTileLayer::resolveKeys(std::vector<std::string> names) const {
+    std::vector<int32_t> slots(keys.size(), -1);
+    for (std::size_t i = 0; i < names.size(); ++i) {
+        auto it = keysMap.find(names[i]);
+        if (it != keysMap.end()) {
+            slots[it->second] = static_cast<int32_t>(i);
+        }
+    }
+    return { std::move(names), std::move(slots) };
+}
+
+} // namespace mbgl
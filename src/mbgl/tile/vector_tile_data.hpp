@@ -0,0 +1,116 @@
+#pragma once
+
+#include <mbgl/tile/geometry_tile_data.hpp>
+#include <mbgl/util/byte_buffer.hpp>
+
+#include <protozero/pbf_reader.hpp>
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace mbgl {
+
+class VectorTileLayer;
+
+using packed_iter_type = protozero::iterator_range<protozero::pbf_reader::const_uint32_iterator>;
+
+class VectorTileFeature : public GeometryTileFeature {
+public:
+    VectorTileFeature(protozero::pbf_reader, const VectorTileLayer&);
+
+    FeatureType getType() const override { return type; }
+    optional<Value> getValue(const std::string&) const override;
+    std::unordered_map<std::string,Value> getProperties() const override;
+    optional<FeatureIdentifier> getID() const override;
+    GeometryCollection getGeometries() const override;
+    void readGeometries(FlatGeometry&) const override;
+    void getValues(const ResolvedKeys&, std::vector<optional<Value>>&) const override;
+
+private:
+    friend class VectorTileLayer;
+
+    // Points this object at another feature of the same layer.
+    void load(protozero::pbf_reader);
+
+    const VectorTileLayer& layer;
+    optional<FeatureIdentifier> id;
+    FeatureType type = FeatureType::Unknown;
+    packed_iter_type tags_iter;
+
+    // The packed geometry commands, decoded straight from the message bytes.
+    const char* geometryBegin = nullptr;
+    const char* geometryEnd = nullptr;
+};
+
+class VectorTileLayer : public GeometryTileLayer {
+public:
+    VectorTileLayer(protozero::pbf_reader);
+
+    std::size_t featureCount() const override { return features.size(); }
+    std::unique_ptr<GeometryTileFeature> getFeature(std::size_t) const override;
+    std::string getName() const override;
+    ResolvedKeys resolveKeys(std::vector<std::string> names) const override;
+    void eachFeature(const std::function<bool (const GeometryTileFeature&, std::size_t)>&) const override;
+
+private:
+    friend class VectorTileFeature;
+
+    // The values table is only decoded once a feature property is actually read.
+    const std::vector<Value>& getValues() const;
+
+    std::string name;
+    uint32_t version = 1;
+    uint32_t extent = 4096;
+    std::unordered_map<std::string, uint32_t> keysMap;
+    std::vector<std::reference_wrapper<const std::string>> keys;
+    std::vector<protozero::pbf_reader> encodedValues;
+    std::vector<protozero::pbf_reader> features;
+
+    mutable std::mutex valuesMutex;
+    mutable std::atomic<bool> valuesDecoded { false };
+    mutable std::vector<Value> values;
+};
+
+/*
+    `VectorTileData` decodes a vector tile PBF lazily. The first `getLayer` call only indexes
+    the layer messages by name; a layer's keys and features are decoded when that layer is
+    first requested, and its values when one of its feature properties is first read. Layers
+    that no style layer refers to are never decoded.
+
+    Tiles may arrive zlib or gzip compressed, as MBTiles packages store them; such data is
+    inflated by the first `getLayer` call, on the worker thread.
+*/
+class VectorTileData : public GeometryTileData {
+public:
+    VectorTileData(ByteBuffer data);
+
+    const GeometryTileLayer* getLayer(const std::string&) const override;
+    std::size_t byteSize() const override;
+
+    // The PBF this data was parsed from, as it was received.
+    const ByteBuffer& getBuffer() const { return data; }
+
+private:
+    class Layer {
+    public:
+        protozero::pbf_reader message;
+        std::unique_ptr<VectorTileLayer> decoded;
+    };
+
+    ByteBuffer data;
+
+    // The inflated tile, when `data` is compressed.
+    mutable std::string inflated;
+
+    // Whichever thread gets to a layer first decodes it.
+    mutable std::mutex mutex;
+    mutable bool indexed = false;
+    mutable std::unordered_map<std::string, Layer> layers;
+};
+
+} // namespace mbgl
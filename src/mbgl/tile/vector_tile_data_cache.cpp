@@ -0,0 +1,47 @@
+#include <mbgl/tile/vector_tile_data_cache.hpp>
+#include <mbgl/tile/vector_tile_data.hpp>
+#include <mbgl/tile/shared_buckets.hpp>
+
+namespace mbgl {
+
+VectorTileDataCache::Result VectorTileDataCache::get(const CanonicalTileID& id,
+                                                     ByteBuffer data) {
+    Entry& entry = entries[id];
+
+    // Each tile makes its own request, so identical responses usually arrive in different
+    // buffers and are compared byte by byte. A revalidated tile with changed contents gets
+    // parsed anew.
+    auto parsed = entry.parsed.lock();
+    auto buckets = entry.buckets.lock();
+    if (parsed && buckets && parsed->getBuffer() == data) {
+        buckets->prune();
+        return { parsed, buckets };
+    }
+
+    // Drop the entries of tiles that no longer exist before adding another.
+    for (auto it = entries.begin(); it != entries.end();) {
+        if (it->first != id && it->second.parsed.expired()) {
+            it = entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    parsed = std::make_shared<VectorTileData>(std::move(data));
+    buckets = std::make_shared<SharedBuckets>();
+    entry.parsed = parsed;
+    entry.buckets = buckets;
+    return { parsed, buckets };
+}
+
+std::size_t VectorTileDataCache::size() const {
+    std::size_t count = 0;
+    for (const auto& entry : entries) {
+        if (!entry.second.parsed.expired()) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+} // namespace mbgl
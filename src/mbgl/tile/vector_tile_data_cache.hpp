@@ -0,0 +1,50 @@
+#pragma once
+
+#include <mbgl/tile/tile_id.hpp>
+#include <mbgl/util/byte_buffer.hpp>
+
+#include <memory>
+#include <unordered_map>
+
+namespace mbgl {
+
+class VectorTileData;
+class SharedBuckets;
+
+/*
+    Shares parsed vector tile data between the tiles of a source that display the same
+    canonical tile. Past a source's maxzoom, every overscaled tile covering a canonical tile
+    loads the same PBF; with this cache, the first of them parses it and the others reuse
+    that `VectorTileData`, so the tile is decoded and held in memory only once. They also share
+    the buckets that don't depend on the zoom level, see `SharedBuckets`.
+
+    Entries don't own the data: it lives as long as a tile (or its worker) still refers to
+    it. The cache is only used from the thread that owns the source.
+*/
+class VectorTileDataCache {
+public:
+    class Result {
+    public:
+        std::shared_ptr<const VectorTileData> data;
+        std::shared_ptr<SharedBuckets> buckets;
+    };
+
+    // Returns the parsed form of `data`, the PBF of tile `id`. If another tile already parsed
+    // identical data for the same canonical tile and still holds on to it, that is returned
+    // instead of parsing `data` again, along with the buckets built from it.
+    Result get(const CanonicalTileID& id, ByteBuffer data);
+
+    // The number of canonical tiles whose parsed data is currently shared.
+    std::size_t size() const;
+
+private:
+    class Entry {
+    public:
+        std::weak_ptr<const VectorTileData> parsed;
+        std::weak_ptr<SharedBuckets> buckets;
+    };
+
+    std::unordered_map<CanonicalTileID, Entry> entries;
+};
+
+} // namespace mbgl
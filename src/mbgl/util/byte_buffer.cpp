@@ -0,0 +1,46 @@
+#include <mbgl/util/byte_buffer.hpp>
+
+#include <cstring>
+#include <stdexcept>
+
+namespace mbgl {
+
+ByteBuffer::ByteBuffer(std::string string)
+    : ByteBuffer(std::make_shared<const std::string>(std::move(string))) {
+}
+
+ByteBuffer::ByteBuffer(std::shared_ptr<const std::string> string) {
+    if (string) {
+        bytes = string->data();
+        length = string->size();
+        owner = std::move(string);
+    }
+}
+
+ByteBuffer::ByteBuffer(std::shared_ptr<std::string> string)
+    : ByteBuffer(std::shared_ptr<const std::string>(std::move(string))) {
+}
+
+ByteBuffer::ByteBuffer(std::shared_ptr<const void> owner_, const char* data, std::size_t size)
+    : owner(std::move(owner_)), bytes(data), length(size) {
+}
+
+ByteBuffer ByteBuffer::slice(std::size_t offset, std::size_t count) const {
+    if (offset > length || count > length - offset) {
+        throw std::out_of_range("slice exceeds the buffer");
+    }
+    return { owner, bytes + offset, count };
+}
+
+std::string ByteBuffer::string() const {
+    return { bytes, length };
+}
+
+bool operator==(const ByteBuffer& lhs, const ByteBuffer& rhs) {
+    if (bool(lhs) != bool(rhs) || lhs.size() != rhs.size()) {
+        return false;
+    }
+    return lhs.data() == rhs.data() || std::memcmp(lhs.data(), rhs.data(), lhs.size()) == 0;
+}
+
+} // namespace mbgl
@@ -2,6 +2,7 @@
 
 #include <zlib.h>
 
+#include <cstdint>
 #include <cstdio>
 #include <cstring>
 #include <stdexcept>
@@ -23,6 +24,10 @@ namespace mbgl {
 namespace util {
 
 std::string compress(const std::string &raw) {
+    return compress(raw.data(), raw.size());
+}
+
+std::string compress(const char *raw, std::size_t size) {
     z_stream deflate_stream;
     memset(&deflate_stream, 0, sizeof(deflate_stream));
 
@@ -31,8 +36,8 @@ std::string compress(const std::string &raw) {
         throw std::runtime_error("failed to initialize deflate");
     }
 
-    deflate_stream.next_in = (Bytef *)raw.data();
-    deflate_stream.avail_in = uInt(raw.size());
+    deflate_stream.next_in = (Bytef *)raw;
+    deflate_stream.avail_in = uInt(size);
 
     std::string result;
     char out[16384];
@@ -57,17 +62,37 @@ std::string compress(const std::string &raw) {
     return result;
 }
 
+bool isCompressed(const std::string &data) {
+    return isCompressed(data.data(), data.size());
+}
+
+bool isCompressed(const char *data, std::size_t size) {
+    if (size < 2) {
+        return false;
+    }
+    const auto b0 = static_cast<uint8_t>(data[0]);
+    const auto b1 = static_cast<uint8_t>(data[1]);
+    const bool gzip = b0 == 0x1F && b1 == 0x8B;
+    const bool zlib = (b0 & 0x0F) == Z_DEFLATED && ((b0 << 8) | b1) % 31 == 0;
+    return gzip || zlib;
+}
+
 std::string decompress(const std::string &raw) {
+    return decompress(raw.data(), raw.size());
+}
+
+std::string decompress(const char *raw, std::size_t size) {
     z_stream inflate_stream;
     memset(&inflate_stream, 0, sizeof(inflate_stream));
 
     // TODO: reuse z_streams
-    if (inflateInit(&inflate_stream) != Z_OK) {
+    // Adding 32 to the window size makes zlib detect both zlib and gzip headers.
+    if (inflateInit2(&inflate_stream, MAX_WBITS + 32) != Z_OK) {
         throw std::runtime_error("failed to initialize inflate");
     }
 
-    inflate_stream.next_in = (Bytef *)raw.data();
-    inflate_stream.avail_in = uInt(raw.size());
+    inflate_stream.next_in = (Bytef *)raw;
+    inflate_stream.avail_in = uInt(size);
 
     std::string result;
     char out[15384];
@@ -81,5 +81,15 @@ int32_t GridIndex<T>::convertToCellCoord(int32_t x) const {
     return util::max(0.0, util::min(d - 1.0, std::floor(x * scale) + padding));
 }
 
+template <class T>
+std::size_t GridIndex<T>::byteSize() const {
+    std::size_t size = elements.capacity() * sizeof(std::pair<T, BBox>) +
+                       cells.capacity() * sizeof(std::vector<size_t>);
+    for (const auto& cell : cells) {
+        size += cell.capacity() * sizeof(size_t);
+    }
+    return size;
+}
+
 template class GridIndex<IndexedSubfeature>;
 } // namespace mbgl
@@ -19,6 +19,14 @@ public:
     void insert(T&& t, const BBox&);
     std::vector<T> query(const BBox&) const;
 
+    // All elements, in insertion order.
+    const std::vector<std::pair<T, BBox>>& getElements() const {
+        return elements;
+    }
+
+    // The memory that the index has allocated.
+    std::size_t byteSize() const;
+
 private:
     int32_t convertToCellCoord(int32_t x) const;
 
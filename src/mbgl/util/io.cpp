@@ -6,6 +6,9 @@
 #include <sstream>
 #include <fstream>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
 namespace mbgl {
@@ -22,8 +25,23 @@ void write_file(const std::string &filename, const std::string &data) {
 }
 
 std::string read_file(const std::string &filename) {
-    std::ifstream file(filename);
+    std::ifstream file(filename, std::ios::binary);
     if (file.good()) {
+        // Reading straight into a string of the right size avoids copying the contents through
+        // a stream buffer, which matters for large tiles and packages.
+        file.seekg(0, std::ios::end);
+        const std::streamoff size = file.tellg();
+        if (size > 0) {
+            std::string data(static_cast<std::size_t>(size), '\0');
+            file.seekg(0, std::ios::beg);
+            if (file.read(&data[0], size) && file.peek() == std::ifstream::traits_type::eof()) {
+                return data;
+            }
+        }
+
+        // Files whose size isn't known up front, such as those in /proc, are read as a stream.
+        file.clear();
+        file.seekg(0, std::ios::beg);
         std::stringstream data;
         data << file.rdbuf();
         return data.str();
@@ -32,6 +50,34 @@ std::string read_file(const std::string &filename) {
     }
 }
 
+ByteBuffer map_file(const std::string &filename) {
+    // Mapping a file costs more than reading it unless the file is reasonably large.
+    const off_t mapThreshold = 64 * 1024;
+
+    const int fd = open(filename.c_str(), O_RDONLY);
+    if (fd == -1) {
+        throw std::runtime_error(std::string("Cannot read file ") + filename);
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) == -1 || !S_ISREG(info.st_mode) || info.st_size < mapThreshold) {
+        close(fd);
+        return ByteBuffer(read_file(filename));
+    }
+
+    const auto size = static_cast<std::size_t>(info.st_size);
+    void* region = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (region == MAP_FAILED) {
+        return ByteBuffer(read_file(filename));
+    }
+
+    std::shared_ptr<const void> owner(region, [size] (void* address) {
+        munmap(address, size);
+    });
+    return ByteBuffer(std::move(owner), static_cast<const char*>(region), size);
+}
+
 void deleteFile(const std::string& filename) {
     const int ret = unlink(filename.c_str());
     if (ret == -1) {
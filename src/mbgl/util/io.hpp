@@ -1,5 +1,7 @@
 #pragma once
 
+#include <mbgl/util/byte_buffer.hpp>
+
 #include <string>
 #include <stdexcept>
 
@@ -15,6 +17,10 @@ struct IOException : std::runtime_error {
 void write_file(const std::string &filename, const std::string &data);
 std::string read_file(const std::string &filename);
 
+// Reads a file like `read_file`, but maps large regular files into memory instead of copying
+// them. The file must not be truncated while the buffer, or any slice of it, is alive.
+ByteBuffer map_file(const std::string &filename);
+
 void deleteFile(const std::string& filename);
 
 } // namespace util
@@ -6,6 +6,8 @@
 #include <chrono>
 #include <functional>
 #include <future>
+#include <thread>
+#include <vector>
 
 using namespace mbgl;
 using namespace std::chrono_literals;
@@ -137,3 +139,111 @@ TEST(Actor, NonConcurrentMailbox) {
     test.invoke(&Test::end);
     endedFuture.wait();
 }
+
+TEST(Actor, Priority) {
+    // Pending mailboxes with a higher priority are processed first.
+
+    struct Blocker {
+        Blocker(ActorRef<Blocker>) {}
+
+        void wait(std::promise<void> entered, std::shared_future<void> release) {
+            entered.set_value();
+            release.wait();
+        }
+    };
+
+    struct Test {
+        std::vector<int>& order;
+
+        Test(ActorRef<Test>, std::vector<int>& order_)
+            : order(order_) {
+        }
+
+        void receive(int i) {
+            order.push_back(i);
+        }
+
+        void end(std::promise<void> promise) {
+            promise.set_value();
+        }
+    };
+
+    ThreadPool pool { 1 };
+
+    std::vector<int> order;
+    Actor<Blocker> blocker(pool);
+    Actor<Test> low(pool, std::ref(order));
+    Actor<Test> high(pool, std::ref(order));
+    low.setPriority(Mailbox::Priority::Low);
+    high.setPriority(Mailbox::Priority::High);
+
+    std::promise<void> enteredPromise;
+    std::future<void> enteredFuture = enteredPromise.get_future();
+    std::promise<void> releasePromise;
+    blocker.invoke(&Blocker::wait, std::move(enteredPromise), releasePromise.get_future().share());
+    enteredFuture.wait();
+
+    // The only worker thread is busy, so these are queued up.
+    low.invoke(&Test::receive, 2);
+    high.invoke(&Test::receive, 1);
+
+    std::promise<void> endedPromise;
+    std::future<void> endedFuture = endedPromise.get_future();
+    low.invoke(&Test::end, std::move(endedPromise));
+
+    releasePromise.set_value();
+    endedFuture.wait();
+
+    EXPECT_EQ((std::vector<int> { 1, 2 }), order);
+}
+
+TEST(Actor, OrderedMailboxMultipleSenders) {
+    // Messages from each individual sender are processed in the order sent, even when
+    // several senders push to the same mailbox concurrently.
+
+    struct Test {
+        std::vector<int> last;
+        std::promise<void> promise;
+        std::size_t remaining;
+
+        Test(ActorRef<Test>, std::size_t senders, std::promise<void> promise_)
+            : last(senders, 0),
+              promise(std::move(promise_)),
+              remaining(senders) {
+        }
+
+        void receive(std::size_t sender, int i) {
+            EXPECT_EQ(i, last[sender] + 1);
+            last[sender] = i;
+        }
+
+        void end() {
+            if (--remaining == 0) {
+                promise.set_value();
+            }
+        }
+    };
+
+    ThreadPool pool { 4 };
+
+    const std::size_t senders = 4;
+    std::promise<void> endedPromise;
+    std::future<void> endedFuture = endedPromise.get_future();
+    Actor<Test> test(pool, senders, std::move(endedPromise));
+
+    std::vector<std::thread> threads;
+    for (std::size_t sender = 0; sender < senders; ++sender) {
+        threads.emplace_back([&, sender] () {
+            for (auto i = 1; i <= 1000; ++i) {
+                test.invoke(&Test::receive, sender, i);
+            }
+            test.invoke(&Test::end);
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    endedFuture.wait();
+}
@@ -0,0 +1,78 @@
+#include <mbgl/actor/actor.hpp>
+#include <mbgl/actor/fork_join.hpp>
+#include <mbgl/util/default_thread_pool.hpp>
+
+#include <mbgl/test/util.hpp>
+
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <vector>
+
+using namespace mbgl;
+
+TEST(ForkJoin, RunsAllTasks) {
+    ThreadPool pool { 4 };
+    EXPECT_EQ(4u, pool.getConcurrency());
+
+    std::vector<std::atomic<int>> runs(1000);
+    forkJoin(pool, 3, runs.size(), [&] (std::size_t i) {
+        runs[i]++;
+    });
+
+    for (auto& count : runs) {
+        EXPECT_EQ(1, count);
+    }
+}
+
+TEST(ForkJoin, RethrowsException) {
+    ThreadPool pool { 2 };
+
+    std::atomic<std::size_t> finished { 0 };
+    EXPECT_THROW(forkJoin(pool, 1, 100, [&] (std::size_t i) {
+        if (i == 50) {
+            throw std::runtime_error("task failed");
+        }
+        finished++;
+    }), std::runtime_error);
+
+    // The other tasks still ran.
+    EXPECT_EQ(99u, finished);
+}
+
+TEST(ForkJoin, FromWithinActor) {
+    // Forking from an actor doesn't deadlock when every thread of the pool is busy
+    // forking as well.
+
+    struct Test {
+        Test(ActorRef<Test>, Scheduler& scheduler_)
+            : scheduler(scheduler_) {
+        }
+
+        void run(std::promise<std::size_t> promise) {
+            std::atomic<std::size_t> sum { 0 };
+            forkJoin(scheduler, 2, 100, [&] (std::size_t i) {
+                sum += i;
+            });
+            promise.set_value(sum);
+        }
+
+        Scheduler& scheduler;
+    };
+
+    ThreadPool pool { 2 };
+
+    std::vector<std::unique_ptr<Actor<Test>>> actors;
+    std::vector<std::future<std::size_t>> futures;
+
+    for (auto i = 0; i < 4; ++i) {
+        std::promise<std::size_t> promise;
+        futures.push_back(promise.get_future());
+        actors.push_back(std::make_unique<Actor<Test>>(pool, std::ref(pool)));
+        actors.back()->invoke(&Test::run, std::move(promise));
+    }
+
+    for (auto& future : futures) {
+        EXPECT_EQ(4950u, future.get());
+    }
+}
@@ -0,0 +1,121 @@
+#include <mbgl/actor/actor.hpp>
+#include <mbgl/actor/scheduler_statistics.hpp>
+#include <mbgl/util/default_thread_pool.hpp>
+#include <mbgl/util/work_stealing_thread_pool.hpp>
+
+#include <mbgl/test/util.hpp>
+
+#include <future>
+
+using namespace mbgl;
+
+TEST(SchedulerStatistics, Histogram) {
+    Histogram histogram;
+    histogram.record(0);
+    histogram.record(1);
+    histogram.record(5);
+    histogram.record(7);
+
+    auto snapshot = histogram.snapshot();
+    EXPECT_EQ(4u, snapshot.count);
+    EXPECT_EQ(13u, snapshot.sum);
+    EXPECT_EQ(7u, snapshot.max);
+    EXPECT_EQ(1u, snapshot.buckets[0]); // 0
+    EXPECT_EQ(1u, snapshot.buckets[1]); // [1, 2)
+    EXPECT_EQ(0u, snapshot.buckets[2]); // [2, 4)
+    EXPECT_EQ(2u, snapshot.buckets[3]); // [4, 8)
+
+    histogram.reset();
+    snapshot = histogram.snapshot();
+    EXPECT_EQ(0u, snapshot.count);
+    EXPECT_EQ(0u, snapshot.max);
+    EXPECT_EQ(0u, snapshot.buckets[3]);
+}
+
+TEST(SchedulerStatistics, EnableResets) {
+    SchedulerStatistics statistics(1);
+    statistics.enable();
+    statistics.recordWaitTime(Milliseconds(1));
+    statistics.recordQueueDepth(3);
+    statistics.recordExecutionTime("type", Milliseconds(1));
+    statistics.recordExecutionTime("type", Milliseconds(2));
+    EXPECT_EQ(2u, statistics.snapshot().executionTime["type"].count);
+
+    statistics.enable();
+    auto snapshot = statistics.snapshot();
+    EXPECT_EQ(0u, snapshot.waitTime.count);
+    EXPECT_EQ(0u, snapshot.queueDepth.count);
+    EXPECT_EQ(0u, snapshot.executionTime["type"].count);
+}
+
+TEST(SchedulerStatistics, SampleInterval) {
+    SchedulerStatistics statistics(1);
+    EXPECT_FALSE(statistics.sample());
+
+    statistics.enable(4);
+    std::size_t sampled = 0;
+    for (auto i = 0; i < 400; ++i) {
+        sampled += statistics.sample();
+    }
+    EXPECT_EQ(100u, sampled);
+}
+
+namespace {
+
+template <class Pool>
+void testStatistics() {
+    struct Test {
+        Test(ActorRef<Test>) {}
+
+        void receive(std::promise<void> promise) {
+            promise.set_value();
+        }
+    };
+
+    Pool pool { 2 };
+    Actor<Test> test(pool);
+    SchedulerStatistics& statistics = *pool.getStatistics();
+
+    auto roundtrip = [&] {
+        std::promise<void> promise;
+        auto future = promise.get_future();
+        test.invoke(&Test::receive, std::move(promise));
+        future.wait();
+    };
+
+    // Nothing is recorded until statistics are enabled.
+    roundtrip();
+    EXPECT_FALSE(statistics.isEnabled());
+    EXPECT_EQ(0u, statistics.snapshot().waitTime.count);
+    EXPECT_TRUE(statistics.snapshot().executionTime.empty());
+
+    statistics.enable();
+    for (auto i = 0; i < 10; ++i) {
+        roundtrip();
+    }
+
+    auto snapshot = statistics.snapshot();
+    // A message that arrives while its mailbox is still being received doesn't need to be
+    // scheduled again.
+    EXPECT_LE(1u, snapshot.waitTime.count);
+    EXPECT_GE(10u, snapshot.waitTime.count);
+    EXPECT_EQ(snapshot.waitTime.count, snapshot.queueDepth.count);
+    ASSERT_EQ(1u, snapshot.executionTime.size());
+    // The last message is recorded after it has fulfilled its promise, so it may be missing.
+    EXPECT_LE(9u, snapshot.executionTime.begin()->second.count);
+    EXPECT_EQ(2u, snapshot.utilization.size());
+
+    const std::string json = statistics.toJSON();
+    EXPECT_NE(std::string::npos, json.find("\"waitTime\""));
+    EXPECT_NE(std::string::npos, json.find("\"utilization\""));
+}
+
+} // namespace
+
+TEST(SchedulerStatistics, ThreadPool) {
+    testStatistics<ThreadPool>();
+}
+
+TEST(SchedulerStatistics, WorkStealingThreadPool) {
+    testStatistics<WorkStealingThreadPool>();
+}
@@ -9,6 +9,8 @@
 
 #include <mbgl/map/mode.hpp>
 
+#include <atomic>
+
 TEST(Buckets, CircleBucket) {
     mbgl::MapMode mapMode = mbgl::MapMode::Still;
 
@@ -21,6 +23,35 @@ TEST(Buckets, FillBucket) {
     ASSERT_FALSE(bucket.hasData());
 }
 
+TEST(Buckets, FillBucketObsolete) {
+    mbgl::GeometryBuffers buffers;
+    buffers.geometry.assign(mbgl::GeometryCollection { { { 0, 0 }, { 10, 0 }, { 10, 10 }, { 0, 0 } } });
+    std::atomic<bool> obsolete { true };
+
+    mbgl::FillBucket bucket;
+    bucket.addGeometry(buffers, obsolete);
+    ASSERT_FALSE(bucket.hasData());
+
+    obsolete = false;
+    bucket.addGeometry(buffers, obsolete);
+    ASSERT_TRUE(bucket.hasData());
+}
+
+TEST(Buckets, FillBucketMemoryUsage) {
+    mbgl::GeometryBuffers buffers;
+    buffers.geometry.assign(mbgl::GeometryCollection { { { 0, 0 }, { 10, 0 }, { 10, 10 }, { 0, 0 } } });
+    std::atomic<bool> obsolete { false };
+
+    mbgl::FillBucket bucket;
+    bucket.addGeometry(buffers, obsolete);
+
+    // Data that hasn't been uploaded only takes up main memory.
+    const mbgl::MemoryUsage usage = bucket.getMemoryUsage();
+    EXPECT_LT(0u, usage.cpu);
+    EXPECT_EQ(bucket.vertices.byteSize() + bucket.lines.byteSize() + bucket.triangles.byteSize(), usage.cpu);
+    EXPECT_EQ(0u, usage.gpu);
+}
+
 TEST(Buckets, LineBucket) {
     uint32_t overscaling = 0;
 
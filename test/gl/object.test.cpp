@@ -4,6 +4,7 @@
 #include <mbgl/gl/offscreen_view.hpp>
 
 #include <mbgl/gl/context.hpp>
+#include <mbgl/programs/fill_program.hpp>
 
 #include <memory>
 
@@ -80,3 +81,55 @@ TEST(GLObject, Store) {
 
     backend.deactivate();
 }
+
+TEST(GLObject, MemoryStats) {
+    HeadlessBackend backend { test::sharedDisplay() };
+    OffscreenView view(backend.getContext());
+
+    gl::Context context;
+    EXPECT_EQ(0u, context.getMemoryStats().total());
+
+    gl::VertexVector<FillVertex> vertices;
+    vertices.emplace_back(FillAttributes::vertex({ 0, 0 }));
+    vertices.emplace_back(FillAttributes::vertex({ 1, 0 }));
+    vertices.emplace_back(FillAttributes::vertex({ 0, 1 }));
+    const std::size_t vertexBytes = vertices.byteSize();
+    auto vertexBuffer = std::make_unique<gl::VertexBuffer<FillVertex>>(
+        context.createVertexBuffer(std::move(vertices)));
+
+    gl::IndexVector<gl::Triangles> indices;
+    indices.emplace_back(0, 1, 2);
+    const std::size_t indexBytes = indices.byteSize();
+    auto indexBuffer = std::make_unique<gl::IndexBuffer<gl::Triangles>>(
+        context.createIndexBuffer(std::move(indices)));
+
+    auto texture = std::make_unique<gl::Texture>(context.createTexture(Size{ 16, 8 }));
+    auto renderbuffer = std::make_unique<gl::Renderbuffer<gl::RenderbufferType::RGBA>>(
+        context.createRenderbuffer<gl::RenderbufferType::RGBA>(Size{ 4, 4 }));
+
+    EXPECT_EQ(vertexBytes, context.getMemoryStats().vertexBuffers);
+    EXPECT_EQ(indexBytes, context.getMemoryStats().indexBuffers);
+    EXPECT_EQ(16u * 8 * 4, context.getMemoryStats().textures);
+    EXPECT_EQ(4u * 4 * 4, context.getMemoryStats().renderbuffers);
+    EXPECT_EQ(vertexBytes + indexBytes + 16 * 8 * 4 + 4 * 4 * 4, context.getMemoryStats().total());
+
+    // Objects count until they are actually deleted.
+    vertexBuffer.reset();
+    indexBuffer.reset();
+    renderbuffer.reset();
+    EXPECT_NE(0u, context.getMemoryStats().vertexBuffers);
+    context.performCleanup();
+    EXPECT_EQ(0u, context.getMemoryStats().vertexBuffers);
+    EXPECT_EQ(0u, context.getMemoryStats().indexBuffers);
+    EXPECT_EQ(0u, context.getMemoryStats().renderbuffers);
+
+    // A texture with storage is deleted instead of going back to the pool.
+    texture.reset();
+    context.performCleanup();
+    EXPECT_EQ(0u, context.getMemoryStats().textures);
+
+    context.reset();
+    EXPECT_EQ(0u, context.getMemoryStats().total());
+
+    backend.deactivate();
+}
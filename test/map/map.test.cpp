@@ -4,6 +4,7 @@
 #include <mbgl/test/fixture_log_observer.hpp>
 
 #include <mbgl/map/map.hpp>
+#include <mbgl/gl/context.hpp>
 #include <mbgl/gl/headless_backend.hpp>
 #include <mbgl/gl/offscreen_view.hpp>
 #include <mbgl/util/default_thread_pool.hpp>
@@ -15,7 +16,10 @@
 #include <mbgl/util/run_loop.hpp>
 #include <mbgl/util/async_task.hpp>
 #include <mbgl/style/layers/background_layer.hpp>
+#include <mbgl/style/layers/line_layer.hpp>
 #include <mbgl/util/color.hpp>
+#include <mbgl/util/logging.hpp>
+#include <mbgl/util/string.hpp>
 
 using namespace mbgl;
 using namespace mbgl::style;
@@ -27,6 +31,28 @@ struct MapTest {
     OffscreenView view { backend.getContext() };
     StubFileSource fileSource;
     ThreadPool threadPool { 4 };
+
+    // Loads a style with vector source "a" and a fill layer "water", serving the same
+    // fixture for every tile.
+    void loadWaterStyle(Map& map) {
+        fileSource.tileResponse = [&](const Resource&) {
+            Response res;
+            res.data = std::make_shared<std::string>(util::read_file("test/fixtures/map/offline/0-0-0.vector.pbf"));
+            return res;
+        };
+
+        map.setStyleJSON(R"STYLE({
+  "sources": {
+    "a": { "type": "vector", "tiles": [ "a/{z}/{x}/{y}" ] }
+  },
+  "layers": [{
+    "id": "water",
+    "type": "fill",
+    "source": "a",
+    "source-layer": "water"
+  }]
+})STYLE");
+    }
 };
 
 TEST(Map, LatLngBehavior) {
@@ -457,6 +483,173 @@ TEST(Map, DontLoadUnneededTiles) {
 }
 
 
+namespace {
+
+void reportReclaimed(const char* level, const SourceMemoryUsage& before, const SourceMemoryUsage& after) {
+    Log::Info(Event::General, "%s: reclaimed %s bytes of cached tiles, %s of active tiles",
+              level,
+              util::toString(before.cache.total() - after.cache.total()).c_str(),
+              util::toString(before.tiles.total() - after.tiles.total()).c_str());
+}
+
+} // namespace
+
+TEST(Map, MemoryPressure) {
+    MapTest test;
+
+    Map map(test.backend, test.view.size, 1, test.fileSource, test.threadPool, MapMode::Still);
+    test.loadWaterStyle(map);
+
+    // Zooming out moves the z1 tiles into the cache.
+    map.setZoom(1);
+    test::render(map, test.view);
+    map.setZoom(0);
+    test::render(map, test.view);
+
+    const SourceMemoryUsage initial = map.getSourceMemoryUsage().at("a");
+    ASSERT_GT(initial.cache.gpu, 0u);
+    ASSERT_GT(initial.tiles.gpu, 0u);
+
+    map.onMemoryPressure(MemoryPressure::Moderate);
+    const SourceMemoryUsage moderate = map.getSourceMemoryUsage().at("a");
+    reportReclaimed("Moderate", initial, moderate);
+    EXPECT_LE(moderate.cache.total(), initial.cache.total() / 2);
+    EXPECT_EQ(0u, moderate.cache.gpu);
+    EXPECT_EQ(initial.tiles.total(), moderate.tiles.total());
+
+    map.onMemoryPressure(MemoryPressure::Critical);
+    const SourceMemoryUsage critical = map.getSourceMemoryUsage().at("a");
+    reportReclaimed("Critical", moderate, critical);
+    EXPECT_EQ(0u, critical.cache.total());
+    EXPECT_EQ(initial.tiles.gpu, critical.tiles.gpu);
+
+    map.onMemoryPressure(MemoryPressure::Background);
+    const SourceMemoryUsage background = map.getSourceMemoryUsage().at("a");
+    reportReclaimed("Background", critical, background);
+    EXPECT_EQ(0u, background.tiles.gpu);
+    EXPECT_EQ(critical.tiles.cpu, background.tiles.cpu);
+
+    // Rendering uploads the displayed tiles again.
+    test::render(map, test.view);
+    EXPECT_EQ(initial.tiles.gpu, map.getSourceMemoryUsage().at("a").tiles.gpu);
+}
+
+TEST(Map, HiddenLayerBuckets) {
+    MapTest test;
+
+    Map map(test.backend, test.view.size, 1, test.fileSource, test.threadPool, MapMode::Still);
+    test.loadWaterStyle(map);
+    auto outline = std::make_unique<LineLayer>("water-outline", "a");
+    outline->setSourceLayer("water");
+    map.addLayer(std::move(outline));
+
+    test::render(map, test.view);
+    const std::size_t visible = map.getSourceMemoryUsage().at("a").tiles.cpu;
+    ASSERT_GT(visible, 0u);
+
+    // The tile only rebuilds the hidden layer, and lets go of its bucket and index entries.
+    map.getLayer("water-outline")->setVisibility(VisibilityType::None);
+    test::render(map, test.view);
+    const std::size_t hidden = map.getSourceMemoryUsage().at("a").tiles.cpu;
+    EXPECT_LT(hidden, visible);
+    EXPECT_GT(hidden, 0u);
+
+    map.getLayer("water-outline")->setVisibility(VisibilityType::Visible);
+    test::render(map, test.view);
+    EXPECT_GT(map.getSourceMemoryUsage().at("a").tiles.cpu, hidden);
+}
+
+TEST(Map, GPUMemoryBudget) {
+    MapTest test;
+
+    Map map(test.backend, test.view.size, 1, test.fileSource, test.threadPool, MapMode::Still);
+    test.loadWaterStyle(map);
+
+    // With no room on the GPU, tiles release their GPU resources as soon as they are cached,
+    // while the displayed ones keep theirs.
+    map.setGPUMemoryBudget(0);
+    EXPECT_EQ(0u, map.getGPUMemoryBudget());
+
+    map.setZoom(1);
+    test::render(map, test.view);
+    map.setZoom(0);
+    test::render(map, test.view);
+
+    const SourceMemoryUsage usage = map.getSourceMemoryUsage().at("a");
+    EXPECT_GT(usage.cache.cpu, 0u);
+    EXPECT_EQ(0u, usage.cache.gpu);
+    EXPECT_GT(usage.tiles.gpu, 0u);
+
+    // Displaying a cached tile again uploads it again.
+    map.setZoom(1);
+    test::render(map, test.view);
+    EXPECT_GT(map.getSourceMemoryUsage().at("a").tiles.gpu, 0u);
+
+    // Raster tiles delete their textures when they release them, so the context's total drops.
+    test.fileSource.tileResponse = [&](const Resource&) {
+        Response res;
+        res.data = std::make_shared<std::string>(util::read_file("test/fixtures/map/disabled_layers/tile.png"));
+        return res;
+    };
+
+    map.setStyleJSON(R"STYLE({
+  "sources": {
+    "r": { "type": "raster", "tiles": [ "r/{z}/{x}/{y}" ], "tileSize": 256 }
+  },
+  "layers": [{
+    "id": "raster",
+    "type": "raster",
+    "source": "r"
+  }]
+})STYLE");
+
+    map.setZoom(1);
+    test::render(map, test.view);
+    const std::size_t displayedTextures = test.backend.getContext().getMemoryStats().textures;
+    EXPECT_GT(map.getSourceMemoryUsage().at("r").tiles.gpu, 0u);
+
+    map.setZoom(0);
+    test::render(map, test.view);
+    test::render(map, test.view);
+
+    EXPECT_EQ(0u, map.getSourceMemoryUsage().at("r").cache.gpu);
+    EXPECT_LT(test.backend.getContext().getMemoryStats().textures, displayedTextures);
+}
+
+TEST(Map, SchedulerStatistics) {
+    MapTest test;
+
+    Map map(test.backend, test.view.size, 1, test.fileSource, test.threadPool, MapMode::Still);
+    EXPECT_NE(std::string::npos, map.getSchedulerStatistics().find("\"executionTime\":{}"));
+
+    map.enableSchedulerStatistics();
+    test.loadWaterStyle(map);
+    test::render(map, test.view);
+    map.disableSchedulerStatistics();
+
+    // The tile workers' messages were recorded.
+    const std::string statistics = map.getSchedulerStatistics();
+    EXPECT_NE(std::string::npos, statistics.find("GeometryTileWorker"));
+    EXPECT_NE(std::string::npos, statistics.find("\"utilization\""));
+}
+
+TEST(Map, LayoutStatistics) {
+    MapTest test;
+
+    Map map(test.backend, test.view.size, 1, test.fileSource, test.threadPool, MapMode::Still);
+    Map other(test.backend, test.view.size, 1, test.fileSource, test.threadPool, MapMode::Still);
+    EXPECT_EQ(0u, map.getLayoutStatistics().completed);
+
+    test.loadWaterStyle(map);
+    other.setStyleJSON(R"STYLE({ "sources": {}, "layers": [] })STYLE");
+    test::render(map, test.view);
+
+    // Each map only counts the work of its own tiles.
+    EXPECT_GT(map.getLayoutStatistics().completed, 0u);
+    EXPECT_EQ(0u, other.getLayoutStatistics().completed);
+    EXPECT_EQ(0u, other.getLayoutStatistics().abandoned);
+}
+
 class MockBackend : public HeadlessBackend {
 public:
     MockBackend(std::shared_ptr<HeadlessDisplay> display_)
@@ -26,8 +26,8 @@ auto readImage(const std::string& name) {
 TEST(SpriteAtlas, Basic) {
     FixtureLog log;
 
-    auto spriteParseResult = parseSprite(util::read_file("test/fixtures/annotations/emerald.png"),
-                                         util::read_file("test/fixtures/annotations/emerald.json"));
+    auto spriteParseResult = parseSprite(util::map_file("test/fixtures/annotations/emerald.png"),
+                                         util::map_file("test/fixtures/annotations/emerald.json"));
 
     SpriteAtlas atlas({ 63, 112 }, 1);
     atlas.setSprites(spriteParseResult.get<Sprites>());
@@ -79,8 +79,8 @@ TEST(SpriteAtlas, Basic) {
 }
 
 TEST(SpriteAtlas, Size) {
-    auto spriteParseResult = parseSprite(util::read_file("test/fixtures/annotations/emerald.png"),
-                                         util::read_file("test/fixtures/annotations/emerald.json"));
+    auto spriteParseResult = parseSprite(util::map_file("test/fixtures/annotations/emerald.png"),
+                                         util::map_file("test/fixtures/annotations/emerald.json"));
 
     SpriteAtlas atlas({ 63, 112 }, 1.4);
     atlas.setSprites(spriteParseResult.get<Sprites>());
@@ -195,8 +195,8 @@ TEST(Sprite, SpriteImageCreation1_5x) {
 }
 
 TEST(Sprite, SpriteParsing) {
-    const auto image_1x = util::read_file("test/fixtures/annotations/emerald.png");
-    const auto json_1x = util::read_file("test/fixtures/annotations/emerald.json");
+    const ByteBuffer image_1x = util::map_file("test/fixtures/annotations/emerald.png");
+    const ByteBuffer json_1x = util::map_file("test/fixtures/annotations/emerald.json");
 
     const auto images = parseSprite(image_1x, json_1x).get<Sprites>();
 
@@ -291,8 +291,8 @@ TEST(Sprite, SpriteParsing) {
 }
 
 TEST(Sprite, SpriteParsingInvalidJSON) {
-    const auto image_1x = util::read_file("test/fixtures/annotations/emerald.png");
-    const auto json_1x = R"JSON({ "image": " })JSON";
+    const ByteBuffer image_1x = util::map_file("test/fixtures/annotations/emerald.png");
+    const ByteBuffer json_1x { std::string(R"JSON({ "image": " })JSON") };
 
     const auto error = parseSprite(image_1x, json_1x).get<std::exception_ptr>();
 
@@ -303,8 +303,8 @@ TEST(Sprite, SpriteParsingInvalidJSON) {
 TEST(Sprite, SpriteParsingEmptyImage) {
     FixtureLog log;
 
-    const auto image_1x = util::read_file("test/fixtures/annotations/emerald.png");
-    const auto json_1x = R"JSON({ "image": {} })JSON";
+    const ByteBuffer image_1x = util::map_file("test/fixtures/annotations/emerald.png");
+    const ByteBuffer json_1x { std::string(R"JSON({ "image": {} })JSON") };
 
     const auto images = parseSprite(image_1x, json_1x).get<Sprites>();
     EXPECT_EQ(0u, images.size());
@@ -320,8 +320,8 @@ TEST(Sprite, SpriteParsingEmptyImage) {
 TEST(Sprite, SpriteParsingSimpleWidthHeight) {
     FixtureLog log;
 
-    const auto image_1x = util::read_file("test/fixtures/annotations/emerald.png");
-    const auto json_1x = R"JSON({ "image": { "width": 32, "height": 32 } })JSON";
+    const ByteBuffer image_1x = util::map_file("test/fixtures/annotations/emerald.png");
+    const ByteBuffer json_1x { std::string(R"JSON({ "image": { "width": 32, "height": 32 } })JSON") };
 
     const auto images = parseSprite(image_1x, json_1x).get<Sprites>();
     EXPECT_EQ(1u, images.size());
@@ -330,8 +330,8 @@ TEST(Sprite, SpriteParsingSimpleWidthHeight) {
 TEST(Sprite, SpriteParsingWidthTooBig) {
     FixtureLog log;
 
-    const auto image_1x = util::read_file("test/fixtures/annotations/emerald.png");
-    const auto json_1x = R"JSON({ "image": { "width": 65536, "height": 32 } })JSON";
+    const ByteBuffer image_1x = util::map_file("test/fixtures/annotations/emerald.png");
+    const ByteBuffer json_1x { std::string(R"JSON({ "image": { "width": 65536, "height": 32 } })JSON") };
 
     const auto images = parseSprite(image_1x, json_1x).get<Sprites>();
     EXPECT_EQ(0u, images.size());
@@ -353,8 +353,8 @@ TEST(Sprite, SpriteParsingWidthTooBig) {
 TEST(Sprite, SpriteParsingNegativeWidth) {
     FixtureLog log;
 
-    const auto image_1x = util::read_file("test/fixtures/annotations/emerald.png");
-    const auto json_1x = R"JSON({ "image": { "width": -1, "height": 32 } })JSON";
+    const ByteBuffer image_1x = util::map_file("test/fixtures/annotations/emerald.png");
+    const ByteBuffer json_1x { std::string(R"JSON({ "image": { "width": -1, "height": 32 } })JSON") };
 
     const auto images = parseSprite(image_1x, json_1x).get<Sprites>();
     EXPECT_EQ(0u, images.size());
@@ -376,8 +376,8 @@ TEST(Sprite, SpriteParsingNegativeWidth) {
 TEST(Sprite, SpriteParsingNullRatio) {
     FixtureLog log;
 
-    const auto image_1x = util::read_file("test/fixtures/annotations/emerald.png");
-    const auto json_1x = R"JSON({ "image": { "width": 32, "height": 32, "pixelRatio": 0 } })JSON";
+    const ByteBuffer image_1x = util::map_file("test/fixtures/annotations/emerald.png");
+    const ByteBuffer json_1x { std::string(R"JSON({ "image": { "width": 32, "height": 32, "pixelRatio": 0 } })JSON") };
 
     const auto images = parseSprite(image_1x, json_1x).get<Sprites>();
     EXPECT_EQ(0u, images.size());
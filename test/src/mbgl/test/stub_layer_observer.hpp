@@ -14,6 +14,14 @@ public:
         if (layerFilterChanged) layerFilterChanged(layer);
     }
 
+    void onLayerSourceLayerChanged(Layer& layer) override {
+        if (layerSourceLayerChanged) layerSourceLayerChanged(layer);
+    }
+
+    void onLayerZoomRangeChanged(Layer& layer) override {
+        if (layerZoomRangeChanged) layerZoomRangeChanged(layer);
+    }
+
     void onLayerVisibilityChanged(Layer& layer) override {
         if (layerVisibilityChanged) layerVisibilityChanged(layer);
     }
@@ -27,6 +35,8 @@ public:
     }
 
     std::function<void (Layer&)> layerFilterChanged;
+    std::function<void (Layer&)> layerSourceLayerChanged;
+    std::function<void (Layer&)> layerZoomRangeChanged;
     std::function<void (Layer&)> layerVisibilityChanged;
     std::function<void (Layer&)> layerPaintPropertyChanged;
     std::function<void (Layer&, const char *)> layerLayoutPropertyChanged;
@@ -48,8 +48,8 @@ TEST(AssetFileSource, Load) {
 
             requestCallback = [this, asset, endCallback](mbgl::Response res) {
                 EXPECT_EQ(nullptr, res.error);
-                ASSERT_TRUE(res.data.get());
-                EXPECT_EQ("content is here\n", *res.data);
+                ASSERT_TRUE(res.data);
+                EXPECT_EQ("content is here\n", res.data.string());
 
                 if (!--numRequests) {
                     endCallback();
@@ -96,8 +96,8 @@ TEST(AssetFileSource, EmptyFile) {
     std::unique_ptr<AsyncRequest> req = fs.request({ Resource::Unknown, "asset://empty" }, [&](Response res) {
         req.reset();
         EXPECT_EQ(nullptr, res.error);
-        ASSERT_TRUE(res.data.get());
-        EXPECT_EQ("", *res.data);
+        ASSERT_TRUE(res.data);
+        EXPECT_EQ("", res.data.string());
         loop.stop();
     });
 
@@ -112,8 +112,8 @@ TEST(AssetFileSource, NonEmptyFile) {
     std::unique_ptr<AsyncRequest> req = fs.request({ Resource::Unknown, "asset://nonempty" }, [&](Response res) {
         req.reset();
         EXPECT_EQ(nullptr, res.error);
-        ASSERT_TRUE(res.data.get());
-        EXPECT_EQ("content is here\n", *res.data);
+        ASSERT_TRUE(res.data);
+        EXPECT_EQ("content is here\n", res.data.string());
         loop.stop();
     });
 
@@ -129,7 +129,7 @@ TEST(AssetFileSource, NonExistentFile) {
         req.reset();
         ASSERT_NE(nullptr, res.error);
         EXPECT_EQ(Response::Error::Reason::NotFound, res.error->reason);
-        ASSERT_FALSE(res.data.get());
+        ASSERT_FALSE(res.data);
         // Do not assert on platform-specific error message.
         loop.stop();
     });
@@ -146,7 +146,7 @@ TEST(AssetFileSource, ReadDirectory) {
         req.reset();
         ASSERT_NE(nullptr, res.error);
         EXPECT_EQ(Response::Error::Reason::NotFound, res.error->reason);
-        ASSERT_FALSE(res.data.get());
+        ASSERT_FALSE(res.data);
         // Do not assert on platform-specific error message.
         loop.stop();
     });
@@ -162,8 +162,8 @@ TEST(AssetFileSource, URLEncoding) {
     std::unique_ptr<AsyncRequest> req = fs.request({ Resource::Unknown, "asset://%6eonempty" }, [&](Response res) {
         req.reset();
         EXPECT_EQ(nullptr, res.error);
-        ASSERT_TRUE(res.data.get());
-        EXPECT_EQ("content is here\n", *res.data);
+        ASSERT_TRUE(res.data);
+        EXPECT_EQ("content is here\n", res.data.string());
         loop.stop();
     });
 
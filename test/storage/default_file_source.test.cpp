@@ -2,6 +2,8 @@
 #include <mbgl/storage/default_file_source.hpp>
 #include <mbgl/util/run_loop.hpp>
 
+#include <future>
+
 using namespace mbgl;
 
 TEST(DefaultFileSource, TEST_REQUIRES_SERVER(CacheResponse)) {
@@ -17,8 +19,8 @@ TEST(DefaultFileSource, TEST_REQUIRES_SERVER(CacheResponse)) {
     req1 = fs.request(resource, [&](Response res) {
         req1.reset();
         EXPECT_EQ(nullptr, res.error);
-        ASSERT_TRUE(res.data.get());
-        EXPECT_EQ("Response 1", *res.data);
+        ASSERT_TRUE(res.data);
+        EXPECT_EQ("Response 1", res.data.string());
         EXPECT_TRUE(bool(res.expires));
         EXPECT_FALSE(bool(res.modified));
         EXPECT_FALSE(bool(res.etag));
@@ -29,8 +31,8 @@ TEST(DefaultFileSource, TEST_REQUIRES_SERVER(CacheResponse)) {
         req2 = fs.request(resource, [&](Response res2) {
             req2.reset();
             EXPECT_EQ(response.error, res2.error);
-            ASSERT_TRUE(res2.data.get());
-            EXPECT_EQ(*response.data, *res2.data);
+            ASSERT_TRUE(res2.data);
+            EXPECT_EQ(response.data.string(), res2.data.string());
             EXPECT_EQ(response.expires, res2.expires);
             EXPECT_EQ(response.modified, res2.modified);
             EXPECT_EQ(response.etag, res2.etag);
@@ -56,8 +58,8 @@ TEST(DefaultFileSource, TEST_REQUIRES_SERVER(CacheRevalidateSame)) {
         req1.reset();
 
         EXPECT_EQ(nullptr, res.error);
-        ASSERT_TRUE(res.data.get());
-        EXPECT_EQ("Response", *res.data);
+        ASSERT_TRUE(res.data);
+        EXPECT_EQ("Response", res.data.string());
         EXPECT_FALSE(bool(res.expires));
         EXPECT_FALSE(bool(res.modified));
         EXPECT_EQ("snowfall", *res.etag);
@@ -72,7 +74,7 @@ TEST(DefaultFileSource, TEST_REQUIRES_SERVER(CacheRevalidateSame)) {
 
                 EXPECT_EQ(nullptr, res2.error);
                 EXPECT_TRUE(res2.notModified);
-                ASSERT_FALSE(res2.data.get());
+                ASSERT_FALSE(res2.data);
                 EXPECT_TRUE(bool(res2.expires));
                 EXPECT_FALSE(bool(res2.modified));
                 // We're not sending the ETag in the 304 reply, but it should still be there.
@@ -101,8 +103,8 @@ TEST(DefaultFileSource, TEST_REQUIRES_SERVER(CacheRevalidateModified)) {
         req1.reset();
 
         EXPECT_EQ(nullptr, res.error);
-        ASSERT_TRUE(res.data.get());
-        EXPECT_EQ("Response", *res.data);
+        ASSERT_TRUE(res.data);
+        EXPECT_EQ("Response", res.data.string());
         EXPECT_FALSE(bool(res.expires));
         EXPECT_EQ(Timestamp{ Seconds(1420070400) }, *res.modified);
         EXPECT_FALSE(res.etag);
@@ -117,7 +119,7 @@ TEST(DefaultFileSource, TEST_REQUIRES_SERVER(CacheRevalidateModified)) {
 
                 EXPECT_EQ(nullptr, res2.error);
                 EXPECT_TRUE(res2.notModified);
-                ASSERT_FALSE(res2.data.get());
+                ASSERT_FALSE(res2.data);
                 EXPECT_TRUE(bool(res2.expires));
                 EXPECT_EQ(Timestamp{ Seconds(1420070400) }, *res2.modified);
                 EXPECT_FALSE(res2.etag);
@@ -144,8 +146,8 @@ TEST(DefaultFileSource, TEST_REQUIRES_SERVER(CacheRevalidateEtag)) {
         req1.reset();
 
         EXPECT_EQ(nullptr, res.error);
-        ASSERT_TRUE(res.data.get());
-        EXPECT_EQ("Response 1", *res.data);
+        ASSERT_TRUE(res.data);
+        EXPECT_EQ("Response 1", res.data.string());
         EXPECT_FALSE(bool(res.expires));
         EXPECT_FALSE(bool(res.modified));
         EXPECT_EQ("response-1", *res.etag);
@@ -159,9 +161,9 @@ TEST(DefaultFileSource, TEST_REQUIRES_SERVER(CacheRevalidateEtag)) {
                 req2.reset();
 
                 EXPECT_EQ(nullptr, res2.error);
-                ASSERT_TRUE(res2.data.get());
+                ASSERT_TRUE(res2.data);
                 EXPECT_NE(res.data, res2.data);
-                EXPECT_EQ("Response 2", *res2.data);
+                EXPECT_EQ("Response 2", res2.data.string());
                 EXPECT_FALSE(bool(res2.expires));
                 EXPECT_FALSE(bool(res2.modified));
                 EXPECT_EQ("response-2", *res2.etag);
@@ -198,8 +200,8 @@ TEST(DefaultFileSource, TEST_REQUIRES_SERVER(HTTPIssue1369)) {
     req = fs.request(resource, [&](Response res) {
         req.reset();
         EXPECT_EQ(nullptr, res.error);
-        ASSERT_TRUE(res.data.get());
-        EXPECT_EQ("Hello World!", *res.data);
+        ASSERT_TRUE(res.data);
+        EXPECT_EQ("Hello World!", res.data.string());
         EXPECT_FALSE(bool(res.expires));
         EXPECT_FALSE(bool(res.modified));
         EXPECT_FALSE(bool(res.etag));
@@ -226,8 +228,8 @@ TEST(DefaultFileSource, OptionalNonExpired) {
     req = fs.request(optionalResource, [&](Response res) {
         req.reset();
         EXPECT_EQ(nullptr, res.error);
-        ASSERT_TRUE(res.data.get());
-        EXPECT_EQ("Cached value", *res.data);
+        ASSERT_TRUE(res.data);
+        EXPECT_EQ("Cached value", res.data.string());
         ASSERT_TRUE(bool(res.expires));
         EXPECT_EQ(*response.expires, *res.expires);
         EXPECT_FALSE(bool(res.modified));
@@ -255,8 +257,8 @@ TEST(DefaultFileSource, OptionalExpired) {
     req = fs.request(optionalResource, [&](Response res) {
         req.reset();
         EXPECT_EQ(nullptr, res.error);
-        ASSERT_TRUE(res.data.get());
-        EXPECT_EQ("Cached value", *res.data);
+        ASSERT_TRUE(res.data);
+        EXPECT_EQ("Cached value", res.data.string());
         ASSERT_TRUE(bool(res.expires));
         EXPECT_EQ(*response.expires, *res.expires);
         EXPECT_FALSE(bool(res.modified));
@@ -291,6 +293,67 @@ TEST(DefaultFileSource, OptionalNotFound) {
     loop.run();
 }
 
+TEST(DefaultFileSource, ResponseCache) {
+    util::RunLoop loop;
+    DefaultFileSource fs(":memory:", ".");
+
+    const Resource optionalResource { Resource::Unknown, "http://127.0.0.1:3000/test", {}, Resource::Optional };
+
+    Response response;
+    response.data = std::make_shared<std::string>("Cached value");
+    fs.put(optionalResource, response);
+
+    std::unique_ptr<AsyncRequest> req;
+    auto request = [&](const std::string& expected) {
+        req = fs.request(optionalResource, [&, expected](Response res) {
+            req.reset();
+            ASSERT_TRUE(res.data);
+            EXPECT_EQ(expected, res.data.string());
+            loop.stop();
+        });
+        loop.run();
+    };
+
+    // The first request reads the response from the database, the second one from memory.
+    request("Cached value");
+    request("Cached value");
+    ResponseCacheStats stats = fs.getResponseCacheStats();
+    EXPECT_EQ(1u, stats.hits);
+    EXPECT_EQ(1u, stats.misses);
+    EXPECT_EQ(1u, stats.entries);
+    EXPECT_DOUBLE_EQ(0.5, stats.hitRate());
+
+    // Storing a resource again replaces the response in memory.
+    response.data = std::make_shared<std::string>("New value");
+    fs.put(optionalResource, response);
+    request("New value");
+    stats = fs.getResponseCacheStats();
+    EXPECT_EQ(1u, stats.hits);
+    EXPECT_EQ(2u, stats.misses);
+
+    // Deleting a region can evict any resource from the database, so it empties the cache.
+    std::promise<void> deleted;
+    const OfflineTilePyramidRegionDefinition definition { "http://127.0.0.1:3000/style.json", LatLngBounds::world(), 0, 0, 1.0 };
+    fs.createOfflineRegion(definition, {}, [&](std::exception_ptr, optional<OfflineRegion> region) {
+        ASSERT_TRUE(bool(region));
+        fs.deleteOfflineRegion(std::move(*region), [&](std::exception_ptr error) {
+            EXPECT_FALSE(bool(error));
+            deleted.set_value();
+        });
+    });
+    deleted.get_future().wait();
+    EXPECT_EQ(0u, fs.getResponseCacheStats().entries);
+    request("New value");
+
+    // Without room, every request goes to the database.
+    fs.setResponseCacheBytes(0);
+    request("New value");
+    stats = fs.getResponseCacheStats();
+    EXPECT_EQ(1u, stats.hits);
+    EXPECT_EQ(4u, stats.misses);
+    EXPECT_EQ(0u, stats.entries);
+}
+
 // Test that we can make a request with etag data that doesn't first try to load
 // from cache like a regular request
 TEST(DefaultFileSource, TEST_REQUIRES_SERVER(NoCacheRefreshEtagNotModified)) {
@@ -313,7 +376,7 @@ TEST(DefaultFileSource, TEST_REQUIRES_SERVER(NoCacheRefreshEtagNotModified)) {
         req.reset();
         EXPECT_EQ(nullptr, res.error);
         EXPECT_TRUE(res.notModified);
-        EXPECT_FALSE(res.data.get());
+        EXPECT_FALSE(res.data);
         ASSERT_TRUE(bool(res.expires));
         EXPECT_LT(util::now(), *res.expires);
         EXPECT_FALSE(bool(res.modified));
@@ -347,8 +410,8 @@ TEST(DefaultFileSource, TEST_REQUIRES_SERVER(NoCacheRefreshEtagModified)) {
         req.reset();
         EXPECT_EQ(nullptr, res.error);
         EXPECT_FALSE(res.notModified);
-        ASSERT_TRUE(res.data.get());
-        EXPECT_EQ("Response", *res.data);
+        ASSERT_TRUE(res.data);
+        EXPECT_EQ("Response", res.data.string());
         EXPECT_FALSE(bool(res.expires));
         EXPECT_FALSE(bool(res.modified));
         ASSERT_TRUE(bool(res.etag));
@@ -382,8 +445,8 @@ TEST(DefaultFileSource, TEST_REQUIRES_SERVER(NoCacheFull)) {
         req.reset();
         EXPECT_EQ(nullptr, res.error);
         EXPECT_FALSE(res.notModified);
-        ASSERT_TRUE(res.data.get());
-        EXPECT_EQ("Response", *res.data);
+        ASSERT_TRUE(res.data);
+        EXPECT_EQ("Response", res.data.string());
         EXPECT_FALSE(bool(res.expires));
         EXPECT_FALSE(bool(res.modified));
         ASSERT_TRUE(bool(res.etag));
@@ -416,7 +479,7 @@ TEST(DefaultFileSource, TEST_REQUIRES_SERVER(NoCacheRefreshModifiedNotModified))
         req.reset();
         EXPECT_EQ(nullptr, res.error);
         EXPECT_TRUE(res.notModified);
-        EXPECT_FALSE(res.data.get());
+        EXPECT_FALSE(res.data);
         ASSERT_TRUE(bool(res.expires));
         EXPECT_LT(util::now(), *res.expires);
         ASSERT_TRUE(bool(res.modified));
@@ -450,8 +513,8 @@ TEST(DefaultFileSource, TEST_REQUIRES_SERVER(NoCacheRefreshModifiedModified)) {
         req.reset();
         EXPECT_EQ(nullptr, res.error);
         EXPECT_FALSE(res.notModified);
-        ASSERT_TRUE(res.data.get());
-        EXPECT_EQ("Response", *res.data);
+        ASSERT_TRUE(res.data);
+        EXPECT_EQ("Response", res.data.string());
         EXPECT_FALSE(bool(res.expires));
         EXPECT_EQ(Timestamp{ Seconds(1420070400) }, *res.modified);
         EXPECT_FALSE(res.etag);
@@ -0,0 +1,117 @@
+#include <mbgl/storage/mbtiles_file_source.hpp>
+#include <mbgl/util/compression.hpp>
+#include <mbgl/util/run_loop.hpp>
+
+#include <unistd.h>
+#include <limits.h>
+#include <gtest/gtest.h>
+
+namespace {
+
+std::string toAbsoluteURL(const std::string& path) {
+    char buff[PATH_MAX + 1];
+    char* cwd = getcwd( buff, PATH_MAX + 1 );
+    std::string url = { "mbtiles://" + std::string(cwd) + "/test/fixtures/mbtiles_file_source/" + path };
+    assert(url.size() <= PATH_MAX);
+    return url;
+}
+
+} // namespace
+
+using namespace mbgl;
+
+TEST(MBTilesFileSource, AcceptsURL) {
+    EXPECT_TRUE(MBTilesFileSource::acceptsURL("mbtiles:///tiles.mbtiles"));
+    EXPECT_FALSE(MBTilesFileSource::acceptsURL("file:///tiles.mbtiles"));
+    EXPECT_FALSE(MBTilesFileSource::acceptsURL("mbtiles"));
+}
+
+TEST(MBTilesFileSource, TileJSON) {
+    util::RunLoop loop;
+
+    MBTilesFileSource fs;
+
+    std::unique_ptr<AsyncRequest> req = fs.request({ Resource::Source, toAbsoluteURL("tiles.mbtiles") }, [&](Response res) {
+        req.reset();
+        EXPECT_EQ(nullptr, res.error);
+        ASSERT_TRUE(res.data);
+        EXPECT_EQ(R"({"tilejson":"2.1.0","tiles":[")" + toAbsoluteURL("tiles.mbtiles") + R"(/{z}/{x}/{y}"],)"
+                  R"("name":"test","format":"pbf","minzoom":0.0,"maxzoom":1.0,)"
+                  R"("bounds":[-180.0,-85.0511,180.0,85.0511],"attribution":"Test attribution"})", res.data.string());
+        loop.stop();
+    });
+
+    loop.run();
+}
+
+TEST(MBTilesFileSource, Tile) {
+    util::RunLoop loop;
+
+    MBTilesFileSource fs;
+
+    // The package stores tile 1/0/0 in TMS row 1. Its data is passed on still gzip compressed.
+    std::unique_ptr<AsyncRequest> req = fs.request({ Resource::Tile, toAbsoluteURL("tiles.mbtiles/1/0/0.pbf") }, [&](Response res) {
+        req.reset();
+        EXPECT_EQ(nullptr, res.error);
+        EXPECT_FALSE(res.noContent);
+        ASSERT_TRUE(res.data);
+        EXPECT_TRUE(util::isCompressed(res.data.string()));
+        EXPECT_EQ("tile 1/0/0", util::decompress(res.data.string()));
+        loop.stop();
+    });
+
+    loop.run();
+}
+
+TEST(MBTilesFileSource, MissingTile) {
+    util::RunLoop loop;
+
+    MBTilesFileSource fs;
+
+    std::unique_ptr<AsyncRequest> req = fs.request({ Resource::Tile, toAbsoluteURL("tiles.mbtiles/1/1/1") }, [&](Response res) {
+        req.reset();
+        EXPECT_EQ(nullptr, res.error);
+        EXPECT_TRUE(res.noContent);
+        EXPECT_FALSE(res.data);
+        loop.stop();
+    });
+
+    loop.run();
+}
+
+TEST(MBTilesFileSource, ConcurrentRequests) {
+    util::RunLoop loop;
+
+    MBTilesFileSource fs;
+
+    std::vector<std::unique_ptr<AsyncRequest>> reqs;
+    std::size_t pending = 3;
+    for (const std::string tile : { "0/0/0", "1/0/1", "1/1/0" }) {
+        reqs.push_back(fs.request({ Resource::Tile, toAbsoluteURL("tiles.mbtiles/" + tile) }, [&, tile](Response res) {
+            EXPECT_EQ(nullptr, res.error);
+            ASSERT_TRUE(res.data);
+            EXPECT_EQ("tile " + tile, util::decompress(res.data.string()));
+            if (--pending == 0) {
+                loop.stop();
+            }
+        }));
+    }
+
+    loop.run();
+}
+
+TEST(MBTilesFileSource, NonExistentPackage) {
+    util::RunLoop loop;
+
+    MBTilesFileSource fs;
+
+    std::unique_ptr<AsyncRequest> req = fs.request({ Resource::Tile, toAbsoluteURL("does_not_exist.mbtiles/0/0/0") }, [&](Response res) {
+        req.reset();
+        ASSERT_NE(nullptr, res.error);
+        EXPECT_EQ(Response::Error::Reason::NotFound, res.error->reason);
+        ASSERT_FALSE(res.data);
+        loop.stop();
+    });
+
+    loop.run();
+}
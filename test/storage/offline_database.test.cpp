@@ -173,7 +173,7 @@ TEST(OfflineDatabase, PutResource) {
 
     auto insertGetResult = db.get(resource);
     EXPECT_EQ(nullptr, insertGetResult->error.get());
-    EXPECT_EQ("first", *insertGetResult->data);
+    EXPECT_EQ("first", insertGetResult->data.string());
 
     response.data = std::make_shared<std::string>("second");
     auto updatePutResult = db.put(resource, response);
@@ -182,7 +182,30 @@ TEST(OfflineDatabase, PutResource) {
 
     auto updateGetResult = db.get(resource);
     EXPECT_EQ(nullptr, updateGetResult->error.get());
-    EXPECT_EQ("second", *updateGetResult->data);
+    EXPECT_EQ("second", updateGetResult->data.string());
+}
+
+TEST(OfflineDatabase, ShrinkMemory) {
+    using namespace mbgl;
+
+    OfflineDatabase db(":memory:");
+
+    Resource resource { Resource::Style, "http://example.com/" };
+    Response response;
+    response.data = std::make_shared<std::string>("first");
+    db.put(resource, response);
+    ASSERT_TRUE(bool(db.get(resource)));
+
+    // The statements are prepared again when they're next used.
+    db.shrinkMemory();
+
+    auto result = db.get(resource);
+    ASSERT_TRUE(bool(result));
+    EXPECT_EQ("first", result->data.string());
+
+    response.data = std::make_shared<std::string>("second");
+    EXPECT_FALSE(db.put(resource, response).first);
+    EXPECT_EQ("second", db.get(resource)->data.string());
 }
 
 TEST(OfflineDatabase, PutTile) {
@@ -207,7 +230,7 @@ TEST(OfflineDatabase, PutTile) {
 
     auto insertGetResult = db.get(resource);
     EXPECT_EQ(nullptr, insertGetResult->error.get());
-    EXPECT_EQ("first", *insertGetResult->data);
+    EXPECT_EQ("first", insertGetResult->data.string());
 
     response.data = std::make_shared<std::string>("second");
     auto updatePutResult = db.put(resource, response);
@@ -216,7 +239,7 @@ TEST(OfflineDatabase, PutTile) {
 
     auto updateGetResult = db.get(resource);
     EXPECT_EQ(nullptr, updateGetResult->error.get());
-    EXPECT_EQ("second", *updateGetResult->data);
+    EXPECT_EQ("second", updateGetResult->data.string());
 }
 
 TEST(OfflineDatabase, PutResourceNoContent) {
@@ -232,7 +255,7 @@ TEST(OfflineDatabase, PutResourceNoContent) {
     auto res = db.get(resource);
     EXPECT_EQ(nullptr, res->error);
     EXPECT_TRUE(res->noContent);
-    EXPECT_FALSE(res->data.get());
+    EXPECT_FALSE(res->data);
 }
 
 TEST(OfflineDatabase, PutTileNotFound) {
@@ -255,7 +278,7 @@ TEST(OfflineDatabase, PutTileNotFound) {
     auto res = db.get(resource);
     EXPECT_EQ(nullptr, res->error);
     EXPECT_TRUE(res->noContent);
-    EXPECT_FALSE(res->data.get());
+    EXPECT_FALSE(res->data);
 }
 
 TEST(OfflineDatabase, CreateRegion) {
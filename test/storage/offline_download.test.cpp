@@ -4,6 +4,7 @@
 #include <mbgl/storage/offline.hpp>
 #include <mbgl/storage/offline_database.hpp>
 #include <mbgl/storage/offline_download.hpp>
+#include <mbgl/storage/response_cache.hpp>
 #include <mbgl/storage/http_file_source.hpp>
 #include <mbgl/util/run_loop.hpp>
 #include <mbgl/util/io.hpp>
@@ -40,6 +41,7 @@ public:
     util::RunLoop loop;
     StubFileSource fileSource;
     OfflineDatabase db { ":memory:" };
+    ResponseCache responseCache;
     std::size_t size = 0;
 
     OfflineRegion createRegion() {
@@ -51,8 +53,8 @@ public:
     Response response(const std::string& path) {
         Response result;
         result.data = std::make_shared<std::string>(util::read_file("test/fixtures/offline_download/"s + path));
-        size_t uncompressed = result.data->size();
-        size_t compressed = util::compress(*result.data).size();
+        size_t uncompressed = result.data.size();
+        size_t compressed = util::compress(result.data.data(), result.data.size()).size();
         size += std::min(uncompressed, compressed);
         return result;
     }
@@ -64,7 +66,7 @@ TEST(OfflineDownload, NoSubresources) {
     OfflineDownload download(
         region.getID(),
         OfflineTilePyramidRegionDefinition("http://127.0.0.1:3000/style.json", LatLngBounds::world(), 0.0, 0.0, 1.0),
-        test.db, test.fileSource);
+        test.db, test.responseCache, test.fileSource);
 
     test.fileSource.styleResponse = [&] (const Resource& resource) {
         EXPECT_EQ("http://127.0.0.1:3000/style.json", resource.url);
@@ -98,13 +100,50 @@ TEST(OfflineDownload, NoSubresources) {
     test.loop.run();
 }
 
+TEST(OfflineDownload, InvalidatesResponseCache) {
+    OfflineTest test;
+    OfflineRegion region = test.createRegion();
+    OfflineDownload download(
+        region.getID(),
+        OfflineTilePyramidRegionDefinition("http://127.0.0.1:3000/style.json", LatLngBounds::world(), 0.0, 0.0, 1.0),
+        test.db, test.responseCache, test.fileSource);
+
+    // The style was stored before, and has been read through the cache since.
+    const Resource style = Resource::style("http://127.0.0.1:3000/style.json");
+    Response stale;
+    stale.data = std::make_shared<std::string>("{}");
+    test.db.put(style, stale);
+    test.responseCache.put(style, *test.db.get(style));
+    ASSERT_TRUE(bool(test.responseCache.get(style)));
+
+    test.fileSource.styleResponse = [&] (const Resource&) {
+        return test.response("empty.style.json");
+    };
+
+    auto observer = std::make_unique<MockObserver>();
+
+    observer->statusChangedFn = [&] (OfflineRegionStatus status) {
+        if (status.complete()) {
+            EXPECT_FALSE(bool(test.responseCache.get(style)));
+            EXPECT_EQ(util::read_file("test/fixtures/offline_download/empty.style.json"),
+                      test.db.get(style)->data.string());
+            test.loop.stop();
+        }
+    };
+
+    download.setObserver(std::move(observer));
+    download.setState(OfflineRegionDownloadState::Active);
+
+    test.loop.run();
+}
+
 TEST(OfflineDownload, InlineSource) {
     OfflineTest test;
     OfflineRegion region = test.createRegion();
     OfflineDownload download(
         region.getID(),
         OfflineTilePyramidRegionDefinition("http://127.0.0.1:3000/style.json", LatLngBounds::world(), 0.0, 0.0, 1.0),
-        test.db, test.fileSource);
+        test.db, test.responseCache, test.fileSource);
 
     test.fileSource.styleResponse = [&] (const Resource& resource) {
         EXPECT_EQ("http://127.0.0.1:3000/style.json", resource.url);
@@ -144,7 +183,7 @@ TEST(OfflineDownload, GeoJSONSource) {
     OfflineDownload download(
         region.getID(),
         OfflineTilePyramidRegionDefinition("http://127.0.0.1:3000/style.json", LatLngBounds::world(), 0.0, 0.0, 1.0),
-        test.db, test.fileSource);
+        test.db, test.responseCache, test.fileSource);
 
     test.fileSource.styleResponse = [&] (const Resource& resource) {
         EXPECT_EQ("http://127.0.0.1:3000/style.json", resource.url);
@@ -179,7 +218,7 @@ TEST(OfflineDownload, Activate) {
     OfflineDownload download(
         region.getID(),
         OfflineTilePyramidRegionDefinition("http://127.0.0.1:3000/style.json", LatLngBounds::world(), 0.0, 0.0, 1.0),
-        test.db, test.fileSource);
+        test.db, test.responseCache, test.fileSource);
 
     test.fileSource.styleResponse = [&] (const Resource& resource) {
         EXPECT_EQ("http://127.0.0.1:3000/style.json", resource.url);
@@ -271,7 +310,7 @@ TEST(OfflineDownload, GetStatusNoResources) {
     OfflineDownload download(
         region.getID(),
         OfflineTilePyramidRegionDefinition("http://127.0.0.1:3000/style.json", LatLngBounds::world(), 0.0, 0.0, 1.0),
-        test.db, test.fileSource);
+        test.db, test.responseCache, test.fileSource);
     OfflineRegionStatus status = download.getStatus();
 
     EXPECT_EQ(OfflineRegionDownloadState::Inactive, status.downloadState);
@@ -288,7 +327,7 @@ TEST(OfflineDownload, GetStatusStyleComplete) {
     OfflineDownload download(
         region.getID(),
         OfflineTilePyramidRegionDefinition("http://127.0.0.1:3000/style.json", LatLngBounds::world(), 0.0, 0.0, 1.0),
-        test.db, test.fileSource);
+        test.db, test.responseCache, test.fileSource);
 
     test.db.putRegionResource(1,
         Resource::style("http://127.0.0.1:3000/style.json"),
@@ -310,7 +349,7 @@ TEST(OfflineDownload, GetStatusStyleAndSourceComplete) {
     OfflineDownload download(
         region.getID(),
         OfflineTilePyramidRegionDefinition("http://127.0.0.1:3000/style.json", LatLngBounds::world(), 0.0, 0.0, 1.0),
-        test.db, test.fileSource);
+        test.db, test.responseCache, test.fileSource);
 
     test.db.putRegionResource(1,
         Resource::style("http://127.0.0.1:3000/style.json"),
@@ -336,7 +375,7 @@ TEST(OfflineDownload, RequestError) {
     OfflineDownload download(
         region.getID(),
         OfflineTilePyramidRegionDefinition("http://127.0.0.1:3000/style.json", LatLngBounds::world(), 0.0, 0.0, 1.0),
-        test.db, test.fileSource);
+        test.db, test.responseCache, test.fileSource);
 
     test.fileSource.styleResponse = [&] (const Resource&) {
         Response response;
@@ -364,7 +403,7 @@ TEST(OfflineDownload, RequestErrorsAreRetried) {
     OfflineDownload download(
         region.getID(),
         OfflineTilePyramidRegionDefinition("http://127.0.0.1:3000/style.json", LatLngBounds::world(), 0.0, 0.0, 1.0),
-        test.db, test.fileSource);
+        test.db, test.responseCache, test.fileSource);
 
     test.fileSource.styleResponse = [&] (const Resource&) {
         test.fileSource.styleResponse = [&] (const Resource&) {
@@ -397,7 +436,7 @@ TEST(OfflineDownload, TileCountLimitExceededNoTileResponse) {
     OfflineDownload download(
         region.getID(),
         OfflineTilePyramidRegionDefinition("http://127.0.0.1:3000/style.json", LatLngBounds::world(), 0.0, 0.0, 1.0),
-        test.db, test.fileSource);
+        test.db, test.responseCache, test.fileSource);
 
     uint64_t tileLimit = 0;
 
@@ -439,7 +478,7 @@ TEST(OfflineDownload, TileCountLimitExceededWithTileResponse) {
     OfflineDownload download(
         region.getID(),
         OfflineTilePyramidRegionDefinition("http://127.0.0.1:3000/style.json", LatLngBounds::world(), 0.0, 0.0, 1.0),
-        test.db, test.fileSource);
+        test.db, test.responseCache, test.fileSource);
 
     uint64_t tileLimit = 1;
 
@@ -493,7 +532,7 @@ TEST(OfflineDownload, WithPreviouslyExistingTile) {
     OfflineDownload download(
         region.getID(),
         OfflineTilePyramidRegionDefinition("http://127.0.0.1:3000/style.json", LatLngBounds::world(), 0.0, 0.0, 1.0),
-        test.db, test.fileSource);
+        test.db, test.responseCache, test.fileSource);
 
     test.fileSource.styleResponse = [&] (const Resource& resource) {
         EXPECT_EQ("http://127.0.0.1:3000/style.json", resource.url);
@@ -527,7 +566,7 @@ TEST(OfflineDownload, ReactivatePreviouslyCompletedDownload) {
     OfflineDownload download(
         region.getID(),
         OfflineTilePyramidRegionDefinition("http://127.0.0.1:3000/style.json", LatLngBounds::world(), 0.0, 0.0, 1.0),
-        test.db, test.fileSource);
+        test.db, test.responseCache, test.fileSource);
 
     test.fileSource.styleResponse = [&] (const Resource& resource) {
         EXPECT_EQ("http://127.0.0.1:3000/style.json", resource.url);
@@ -553,7 +592,7 @@ TEST(OfflineDownload, ReactivatePreviouslyCompletedDownload) {
     OfflineDownload redownload(
         region.getID(),
         OfflineTilePyramidRegionDefinition("http://127.0.0.1:3000/style.json", LatLngBounds::world(), 0.0, 0.0, 1.0),
-        test.db, test.fileSource);
+        test.db, test.responseCache, test.fileSource);
 
     std::vector<OfflineRegionStatus> statusesAfterReactivate;
 
@@ -594,7 +633,7 @@ TEST(OfflineDownload, Deactivate) {
     OfflineDownload download(
         region.getID(),
         OfflineTilePyramidRegionDefinition("http://127.0.0.1:3000/style.json", LatLngBounds::world(), 0.0, 0.0, 1.0),
-        test.db, test.fileSource);
+        test.db, test.responseCache, test.fileSource);
 
     test.fileSource.styleResponse = [&] (const Resource& resource) {
         EXPECT_EQ("http://127.0.0.1:3000/style.json", resource.url);
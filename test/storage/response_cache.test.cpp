@@ -0,0 +1,94 @@
+#include <mbgl/test/util.hpp>
+#include <mbgl/storage/response_cache.hpp>
+
+#include <memory>
+#include <string>
+
+using namespace mbgl;
+
+namespace {
+
+Response response(const std::string& data) {
+    Response res;
+    res.data = std::make_shared<std::string>(data);
+    return res;
+}
+
+const Resource a { Resource::Unknown, "a" };
+const Resource b { Resource::Unknown, "b" };
+const Resource c { Resource::Unknown, "c" };
+
+} // namespace
+
+TEST(ResponseCache, GetPut) {
+    ResponseCache cache(100);
+
+    EXPECT_FALSE(bool(cache.get(a)));
+
+    cache.put(a, response("data"));
+    auto res = cache.get(a);
+    ASSERT_TRUE(bool(res));
+    ASSERT_TRUE(res->data);
+    EXPECT_EQ("data", res->data.string());
+
+    // Putting a response again replaces it.
+    cache.put(a, response("other"));
+    EXPECT_EQ("other", cache.get(a)->data.string());
+
+    const ResponseCacheStats stats = cache.getStats();
+    EXPECT_EQ(2u, stats.hits);
+    EXPECT_EQ(1u, stats.misses);
+    EXPECT_DOUBLE_EQ(2.0 / 3, stats.hitRate());
+    EXPECT_EQ(1u, stats.entries);
+    EXPECT_EQ(6u, stats.bytes);
+
+    cache.remove(a);
+    EXPECT_FALSE(bool(cache.get(a)));
+    EXPECT_EQ(0u, cache.getStats().bytes);
+}
+
+TEST(ResponseCache, ByteLimit) {
+    // Each entry takes up 10 bytes: one for the URL and nine for the data.
+    ResponseCache cache(25);
+
+    cache.put(a, response("123456789"));
+    cache.put(b, response("123456789"));
+    EXPECT_EQ(20u, cache.getStats().bytes);
+
+    // Using a response makes it the most recently used one, so the other one is evicted.
+    EXPECT_TRUE(bool(cache.get(a)));
+    cache.put(c, response("123456789"));
+    EXPECT_TRUE(bool(cache.get(a)));
+    EXPECT_FALSE(bool(cache.get(b)));
+    EXPECT_TRUE(bool(cache.get(c)));
+    EXPECT_EQ(20u, cache.getStats().bytes);
+
+    // A response that doesn't fit at all isn't kept, nor does it evict anything.
+    cache.put(b, response(std::string(30, 'x')));
+    EXPECT_FALSE(bool(cache.get(b)));
+    EXPECT_EQ(2u, cache.getStats().entries);
+
+    cache.setMaxBytes(15);
+    EXPECT_FALSE(bool(cache.get(a)));
+    EXPECT_TRUE(bool(cache.get(c)));
+
+    cache.setMaxBytes(0);
+    EXPECT_EQ(0u, cache.getStats().entries);
+    EXPECT_EQ(0u, cache.getStats().bytes);
+    cache.put(a, response(""));
+    EXPECT_FALSE(bool(cache.get(a)));
+}
+
+TEST(ResponseCache, Clear) {
+    ResponseCache cache;
+
+    cache.put(a, response("data"));
+    EXPECT_TRUE(bool(cache.get(a)));
+    cache.clear();
+    EXPECT_FALSE(bool(cache.get(a)));
+
+    // The counts persist.
+    EXPECT_EQ(1u, cache.getStats().hits);
+    EXPECT_EQ(1u, cache.getStats().misses);
+    EXPECT_EQ(0u, cache.getStats().entries);
+}
@@ -1,9 +1,12 @@
 #include <mbgl/test/util.hpp>
 #include <mbgl/util/feature.hpp>
 #include <mbgl/util/geometry.hpp>
+#include <mbgl/util/io.hpp>
+#include <mbgl/tile/vector_tile_data.hpp>
 
 #include <mbgl/style/filter.hpp>
 #include <mbgl/style/filter_evaluator.hpp>
+#include <mbgl/style/compiled_filter.hpp>
 #include <mbgl/style/rapidjson_conversion.hpp>
 #include <mbgl/style/conversion.hpp>
 #include <mbgl/style/conversion/filter.hpp>
@@ -123,3 +126,32 @@ TEST(Filter, ID) {
 
     ASSERT_FALSE(parse("[\"==\", \"$id\", 1234]")(feature2));
 }
+
+TEST(Filter, Compiled) {
+    VectorTileData data(std::make_shared<std::string>(
+        util::read_file("test/fixtures/api/assets/streets/10-163-395.vector.pbf")));
+
+    const std::vector<std::pair<std::string, Filter>> filters = {
+        { "road", parse(R"(["all", ["==", "$type", "LineString"], ["in", "class", "motorway", "main"], ["!=", "structure", "tunnel"]])") },
+        { "road", parse(R"(["any", ["==", "oneway", 1], ["!has", "type"], ["==", "missing", 1]])") },
+        { "landuse", parse(R"(["none", ["in", "class", "park", "wood"], ["==", "$type", "Point"]])") },
+        { "place_label", parse(R"(["all", ["<=", "localrank", 1], ["has", "name"], ["!in", "type", "town", "village"]])") },
+        { "water", parse(R"(["==", "class", "ocean"])") },
+        { "poi_label", parse(R"(["any", [">", "$id", 1000], ["all", ["<", "scalerank", 3], ["!=", "maki", "park"], ["!has", "missing"]]])") },
+        { "water", Filter() },
+    };
+
+    for (const auto& entry : filters) {
+        const GeometryTileLayer* layer = data.getLayer(entry.first);
+        ASSERT_NE(nullptr, layer);
+
+        const Filter& filter = entry.second;
+        CompiledFilter compiled(filter, *layer);
+
+        for (std::size_t i = 0; i < layer->featureCount(); ++i) {
+            auto feature = layer->getFeature(i);
+            EXPECT_EQ(filter(feature->getType(), feature->getID(), [&] (const std::string& key) { return feature->getValue(key); }),
+                      compiled(*feature));
+        }
+    }
+}
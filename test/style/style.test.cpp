@@ -5,6 +5,7 @@
 #include <mbgl/style/source_impl.hpp>
 #include <mbgl/style/sources/vector_source.hpp>
 #include <mbgl/style/layer.hpp>
+#include <mbgl/style/layers/line_layer.hpp>
 #include <mbgl/util/io.hpp>
 #include <mbgl/util/run_loop.hpp>
 
@@ -134,3 +135,47 @@ TEST(Style, DuplicateSource) {
         //Expected
     }
 }
+
+TEST(Style, LayerSnapshot) {
+    util::RunLoop loop;
+
+    StubFileSource fileSource;
+    Style style { fileSource, 1.0 };
+
+    Layer* layer = style.addLayer(std::make_unique<LineLayer>("line", "source"));
+
+    // Snapshots are shared until the layer changes.
+    auto snapshot = style.getLayerSnapshot(*layer);
+    EXPECT_EQ(snapshot, style.getLayerSnapshot(*layer));
+
+    // Paint properties aren't used by layout, so they don't invalidate the snapshot.
+    layer->as<LineLayer>()->setLineWidth(2);
+    EXPECT_EQ(snapshot, style.getLayerSnapshot(*layer));
+
+    // Layout properties do, but the old snapshot is left as it was.
+    layer->as<LineLayer>()->setLineCap(LineCapType::Round);
+    auto updated = style.getLayerSnapshot(*layer);
+    EXPECT_NE(snapshot, updated);
+    EXPECT_TRUE(snapshot->as<LineLayer>()->getLineCap().isUndefined());
+    EXPECT_EQ(LineCapType::Round, updated->as<LineLayer>()->getLineCap().asConstant());
+
+    layer->setVisibility(VisibilityType::None);
+    EXPECT_NE(updated, style.getLayerSnapshot(*layer));
+    EXPECT_EQ(VisibilityType::Visible, updated->getVisibility());
+
+    // So do the source layer and the zoom range.
+    updated = style.getLayerSnapshot(*layer);
+    layer->as<LineLayer>()->setSourceLayer("road");
+    auto sourceLayerUpdated = style.getLayerSnapshot(*layer);
+    EXPECT_NE(updated, sourceLayerUpdated);
+    EXPECT_EQ("road", sourceLayerUpdated->as<LineLayer>()->getSourceLayer());
+
+    layer->setMinZoom(4);
+    auto minZoomUpdated = style.getLayerSnapshot(*layer);
+    EXPECT_NE(sourceLayerUpdated, minZoomUpdated);
+    EXPECT_EQ(4, minZoomUpdated->getMinZoom());
+
+    layer->setMaxZoom(12);
+    EXPECT_NE(minZoomUpdated, style.getLayerSnapshot(*layer));
+    EXPECT_EQ(12, style.getLayerSnapshot(*layer)->getMaxZoom());
+}
@@ -232,6 +232,27 @@ TEST(Layer, Observer) {
     layer->setFilter(NullFilter());
     EXPECT_TRUE(filterChanged);
 
+    // Notifies observer on source layer change.
+    bool sourceLayerChanged = false;
+    observer.layerSourceLayerChanged = [&] (Layer& layer_) {
+        EXPECT_EQ(layer.get(), &layer_);
+        sourceLayerChanged = true;
+    };
+    layer->setSourceLayer("road");
+    EXPECT_TRUE(sourceLayerChanged);
+
+    // Notifies observer on zoom range change.
+    bool zoomRangeChanged = false;
+    observer.layerZoomRangeChanged = [&] (Layer& layer_) {
+        EXPECT_EQ(layer.get(), &layer_);
+        zoomRangeChanged = true;
+    };
+    layer->setMinZoom(4);
+    EXPECT_TRUE(zoomRangeChanged);
+    zoomRangeChanged = false;
+    layer->setMaxZoom(12);
+    EXPECT_TRUE(zoomRangeChanged);
+
     // Notifies observer on visibility change.
     bool visibilityChanged = false;
     observer.layerVisibilityChanged = [&] (Layer& layer_) {
@@ -0,0 +1,70 @@
+#include <mbgl/test/util.hpp>
+#include <mbgl/tile/flat_geometry.hpp>
+
+using namespace mbgl;
+
+TEST(FlatGeometry, Rings) {
+    const GeometryCollection collection = {
+      { {0, 0}, {0, 40}, {40, 40}, {40, 0}, {0, 0} },
+      { {10, 10}, {20, 10}, {20, 20}, {10, 10} }
+    };
+
+    FlatGeometry geometry(collection);
+    ASSERT_EQ(geometry.ringCount(), 2u);
+    ASSERT_EQ(geometry.ring(0).size(), 5u);
+    ASSERT_EQ(geometry.ring(1).size(), 4u);
+    ASSERT_EQ(geometry.ring(1).front(), GeometryCoordinate(10, 10));
+    ASSERT_EQ(geometry.allPoints().size(), 9u);
+    ASSERT_EQ(geometry.toCollection(), collection);
+
+    geometry.clear();
+    ASSERT_EQ(geometry.ringCount(), 0u);
+    ASSERT_TRUE(geometry.allPoints().empty());
+
+    geometry.beginRing();
+    geometry.addPoint({ 1, 2 });
+    geometry.addPoint({ 3, 4 });
+    ASSERT_EQ(geometry.toCollection(), GeometryCollection({ { {1, 2}, {3, 4} } }));
+}
+
+TEST(FlatGeometry, RingPolygons) {
+    const FlatGeometry geometry(GeometryCollection {
+      { {0, 0}, {0, 40}, {40, 40}, {40, 0}, {0, 0} },
+      { {10, 10}, {20, 10}, {20, 20}, {10, 10} },
+      { {0, 0}, {0, 0}, {0, 0} }, // Degenerate rings are dropped.
+      { {50, 0}, {50, 40}, {90, 40}, {90, 0}, {50, 0} }
+    });
+
+    RingPolygons polygons;
+    polygons.classify(geometry);
+    ASSERT_EQ(polygons.polygonCount(), 2u);
+
+    std::vector<GeometryRing> polygon;
+    polygons.getPolygon(0, polygon);
+    ASSERT_EQ(polygon.size(), 2u);
+    ASSERT_EQ(polygon[1].front().x, 10);
+
+    polygons.getPolygon(1, polygon);
+    ASSERT_EQ(polygon.size(), 1u);
+    ASSERT_EQ(polygon[0].front().x, 50);
+
+    // Agrees with the GeometryCollection version.
+    const auto expected = classifyRings(geometry.toCollection());
+    ASSERT_EQ(expected.size(), polygons.polygonCount());
+}
+
+TEST(FlatGeometry, LimitHoles) {
+    const FlatGeometry geometry(GeometryCollection {
+      { {0, 0}, {0, 40}, {40, 40}, {40, 0}, {0, 0} },
+      { {30, 30}, {32, 30}, {32, 32}, {30, 30} },
+      { {10, 10}, {20, 10}, {20, 20}, {10, 10} }
+    });
+
+    std::vector<GeometryRing> polygon = { geometry.ring(0), geometry.ring(1), geometry.ring(2) };
+    limitHoles(polygon, 1);
+
+    // ensure we've kept the right rings (ones with largest areas)
+    ASSERT_EQ(polygon.size(), 2u);
+    ASSERT_EQ(polygon[0][0].x, 0);
+    ASSERT_EQ(polygon[1][0].x, 10);
+}
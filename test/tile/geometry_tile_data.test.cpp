@@ -1,5 +1,6 @@
 #include <mbgl/test/util.hpp>
 #include <mbgl/tile/geometry_tile_data.hpp>
+#include <mbgl/tile/flat_geometry.hpp>
 
 using namespace mbgl;
 
@@ -59,3 +60,40 @@ TEST(GeometryTileData, limitHoles2) {
     ASSERT_EQ(polygon[0][0].x, 0);
     ASSERT_EQ(polygon[1][0].x, 10);
 }
+
+TEST(GeometryTileData, fixupPolygonsValid) {
+    // Correctly wound, strictly simple polygons are returned as they are.
+    const GeometryCollection polygon = {
+      { {0, 0}, {40, 0}, {40, 40}, {0, 40}, {0, 0} },
+      { {10, 10}, {10, 20}, {20, 20}, {20, 10}, {10, 10} },
+      { {50, 0}, {90, 0}, {90, 40}, {50, 40}, {50, 0} }
+    };
+    ASSERT_GT(signedArea(polygon[0]), 0);
+    ASSERT_LT(signedArea(polygon[1]), 0);
+
+    EXPECT_EQ(polygon, fixupPolygons(polygon));
+}
+
+TEST(GeometryTileData, fixupPolygonsInvalid) {
+    // Wrong winding order.
+    GeometryCollection reversed = fixupPolygons({
+      { {0, 0}, {0, 40}, {40, 40}, {40, 0}, {0, 0} }
+    });
+    ASSERT_EQ(1u, reversed.size());
+    EXPECT_GT(signedArea(reversed[0]), 0);
+
+    // A hole that isn't inside its outer ring.
+    GeometryCollection outside = fixupPolygons({
+      { {0, 0}, {40, 0}, {40, 40}, {0, 40}, {0, 0} },
+      { {50, 10}, {50, 20}, {60, 20}, {60, 10}, {50, 10} }
+    });
+    ASSERT_EQ(2u, outside.size());
+    EXPECT_GT(signedArea(outside[0]), 0);
+    EXPECT_GT(signedArea(outside[1]), 0);
+
+    // A self-intersecting ring is split up.
+    GeometryCollection bowtie = fixupPolygons({
+      { {0, 0}, {40, 40}, {40, 0}, {0, 40}, {0, 0} }
+    });
+    EXPECT_EQ(2u, bowtie.size());
+}
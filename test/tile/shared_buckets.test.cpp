@@ -0,0 +1,120 @@
+#include <mbgl/test/util.hpp>
+#include <mbgl/tile/shared_buckets.hpp>
+#include <mbgl/geometry/feature_index.hpp>
+#include <mbgl/renderer/fill_bucket.hpp>
+#include <mbgl/renderer/line_bucket.hpp>
+#include <mbgl/style/layers/fill_layer.hpp>
+#include <mbgl/style/layers/line_layer.hpp>
+#include <mbgl/style/layer_impl.hpp>
+
+using namespace mbgl;
+using namespace mbgl::style;
+
+namespace {
+
+SharedBuckets::Entry entry(std::shared_ptr<Bucket> bucket) {
+    return { std::move(bucket), std::make_shared<FeatureIndex>() };
+}
+
+} // namespace
+
+TEST(SharedBuckets, Fill) {
+    SharedBuckets shared;
+    std::shared_ptr<const Layer> layer = std::make_shared<FillLayer>("fill", "source");
+    std::shared_ptr<Bucket> bucket = std::make_shared<FillBucket>();
+
+    EXPECT_FALSE(shared.find(layer, OverscaledTileID(16, 14, 10, 10)));
+    shared.add(layer, OverscaledTileID(15, 14, 10, 10), entry(bucket));
+
+    // Fill buckets can be drawn at any level of overscaling.
+    auto found = shared.find(layer, OverscaledTileID(18, 14, 10, 10));
+    ASSERT_TRUE(bool(found));
+    EXPECT_EQ(bucket, found->bucket);
+    EXPECT_NE(nullptr, found->featureIndex);
+
+    // But only for the layer snapshot they were built from.
+    std::shared_ptr<const Layer> changed = layer->baseImpl->clone();
+    EXPECT_FALSE(shared.find(changed, OverscaledTileID(18, 14, 10, 10)));
+}
+
+TEST(SharedBuckets, Line) {
+    SharedBuckets shared;
+
+    auto line = std::make_unique<LineLayer>("line", "source");
+    line->setLineJoin(Function<LineJoinType>({ { 16, LineJoinType::Miter }, { 17, LineJoinType::Round } }, 1));
+    std::shared_ptr<const Layer> layer = std::move(line);
+
+    shared.add(layer, OverscaledTileID(15, 14, 10, 10), entry(std::make_shared<LineBucket>(2)));
+
+    // Line joins depend on the zoom dependent layout properties.
+    EXPECT_TRUE(bool(shared.find(layer, OverscaledTileID(16, 14, 10, 10))));
+    EXPECT_FALSE(bool(shared.find(layer, OverscaledTileID(17, 14, 10, 10))));
+}
+
+TEST(SharedBuckets, Prune) {
+    SharedBuckets shared;
+    std::shared_ptr<const Layer> layer = std::make_shared<FillLayer>("fill", "source");
+    std::shared_ptr<Bucket> bucket = std::make_shared<FillBucket>();
+    std::weak_ptr<Bucket> weak = bucket;
+
+    // The bucket stays while a tile uses it and the snapshot is current.
+    shared.add(layer, OverscaledTileID(15, 14, 10, 10), entry(bucket));
+    shared.prune();
+    EXPECT_FALSE(weak.expired());
+    EXPECT_EQ(1u, shared.size());
+
+    // Once the layer changed, it goes even though tiles still use it.
+    layer.reset();
+    shared.prune();
+    EXPECT_EQ(0u, shared.size());
+    bucket.reset();
+    EXPECT_TRUE(weak.expired());
+}
+
+TEST(SharedBuckets, UseCount) {
+    SharedBuckets shared;
+    std::shared_ptr<const Layer> layer = std::make_shared<FillLayer>("fill", "source");
+    std::shared_ptr<Bucket> bucket = std::make_shared<FillBucket>();
+    std::shared_ptr<Bucket> other = std::make_shared<FillBucket>();
+    EXPECT_EQ(1u, shared.useCount(bucket));
+
+    // The reference kept by the shared buckets doesn't count.
+    shared.add(layer, OverscaledTileID(15, 14, 10, 10), entry(bucket));
+    EXPECT_EQ(1u, shared.useCount(bucket));
+    EXPECT_EQ(1u, shared.useCount(other));
+
+    // Another tile that picks up the bucket does.
+    auto found = shared.find(layer, OverscaledTileID(16, 14, 10, 10));
+    EXPECT_EQ(2u, shared.useCount(bucket));
+    found = {};
+    EXPECT_EQ(1u, shared.useCount(bucket));
+}
+
+TEST(SharedBuckets, PruneUnused) {
+    SharedBuckets shared;
+
+    auto line = std::make_unique<LineLayer>("line", "source");
+    line->setLineJoin(Function<LineJoinType>({ { 16, LineJoinType::Miter }, { 17, LineJoinType::Round } }, 1));
+    std::shared_ptr<const Layer> layer = std::move(line);
+
+    std::shared_ptr<Bucket> miter = std::make_shared<LineBucket>(2);
+    std::shared_ptr<Bucket> round = std::make_shared<LineBucket>(4);
+    shared.add(layer, OverscaledTileID(16, 14, 10, 10), entry(miter));
+    shared.add(layer, OverscaledTileID(17, 14, 10, 10), entry(round));
+
+    // No tile of the second zoom level is left.
+    round.reset();
+    shared.prune();
+    EXPECT_EQ(1u, shared.size());
+    EXPECT_TRUE(bool(shared.find(layer, OverscaledTileID(16, 14, 10, 10))));
+    EXPECT_FALSE(bool(shared.find(layer, OverscaledTileID(17, 14, 10, 10))));
+
+    // A bucket that was found is in use until it is dropped again.
+    auto found = shared.find(layer, OverscaledTileID(16, 14, 10, 10));
+    miter.reset();
+    shared.prune();
+    EXPECT_EQ(1u, shared.size());
+    found = {};
+    shared.prune();
+    EXPECT_EQ(0u, shared.size());
+}
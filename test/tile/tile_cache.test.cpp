@@ -0,0 +1,302 @@
+#include <mbgl/test/util.hpp>
+#include <mbgl/tile/tile_cache.hpp>
+#include <mbgl/tile/tile_memory_manager.hpp>
+#include <mbgl/tile/tile.hpp>
+
+using namespace mbgl;
+
+namespace {
+
+class FakeTile : public Tile {
+public:
+    FakeTile(const OverscaledTileID& id_, std::size_t bytes_)
+        : Tile(id_), bytes(bytes_) {
+        availableData = DataAvailability::All;
+    }
+
+    void setNecessity(Necessity) override {}
+    void cancel() override {}
+    Bucket* getBucket(const style::Layer&) override { return nullptr; }
+
+    MemoryUsage getMemoryUsage() const override {
+        return { bytes / 2, gpuReleased ? 0 : bytes - bytes / 2 };
+    }
+
+    void releaseGPUResources() override {
+        gpuReleased = true;
+    }
+
+    void releaseFeatureIndex() override {
+        featureIndexReleased = true;
+    }
+
+    void redoLayout(const std::unordered_set<std::string>& bucketNames) override {
+        invalidatedBuckets.insert(bucketNames.begin(), bucketNames.end());
+        ++layouts;
+    }
+
+    const std::size_t bytes;
+    bool gpuReleased = false;
+    bool featureIndexReleased = false;
+    std::unordered_set<std::string> invalidatedBuckets;
+    std::size_t layouts = 0;
+};
+
+// Keeps the GPU resources of buckets that it shares with displayed tiles.
+class SharingTile : public FakeTile {
+public:
+    SharingTile(const OverscaledTileID& id_, std::size_t bytes_, std::size_t sharedBytes_)
+        : FakeTile(id_, bytes_), sharedBytes(sharedBytes_) {
+    }
+
+    MemoryUsage getMemoryUsage() const override {
+        return { bytes / 2, gpuReleased ? sharedBytes : bytes - bytes / 2 };
+    }
+
+    const std::size_t sharedBytes;
+};
+
+const OverscaledTileID a { 1, 0, 0 };
+const OverscaledTileID b { 1, 0, 1 };
+const OverscaledTileID c { 1, 1, 0 };
+
+} // namespace
+
+TEST(TileCache, ByteLimit) {
+    TileMemoryManager manager(100);
+    TileCache cache;
+    cache.setManager(&manager);
+
+    cache.add(a, std::make_unique<FakeTile>(a, 40));
+    cache.add(b, std::make_unique<FakeTile>(b, 40));
+    EXPECT_EQ(80u, manager.getBytes());
+    EXPECT_EQ(40u, cache.getMemoryUsage().cpu);
+    EXPECT_EQ(40u, cache.getMemoryUsage().gpu);
+
+    // The oldest tile makes room for the newest.
+    cache.add(c, std::make_unique<FakeTile>(c, 40));
+    EXPECT_FALSE(cache.has(a));
+    EXPECT_TRUE(cache.has(b));
+    EXPECT_TRUE(cache.has(c));
+    EXPECT_EQ(80u, manager.getBytes());
+
+    manager.setMaxBytes(50);
+    EXPECT_FALSE(cache.has(b));
+    EXPECT_TRUE(cache.has(c));
+    EXPECT_EQ(40u, manager.getBytes());
+
+    // A tile that doesn't fit at all isn't kept.
+    cache.add(a, std::make_unique<FakeTile>(a, 60));
+    EXPECT_FALSE(cache.has(a));
+    EXPECT_FALSE(cache.has(c));
+    EXPECT_EQ(0u, manager.getBytes());
+    EXPECT_EQ(0u, cache.getMemoryUsage().total());
+}
+
+TEST(TileCache, Get) {
+    TileMemoryManager manager(100);
+    TileCache cache;
+    cache.setManager(&manager);
+
+    cache.add(a, std::make_unique<FakeTile>(a, 30));
+    cache.add(b, std::make_unique<FakeTile>(b, 30));
+
+    auto tile = cache.get(a);
+    ASSERT_NE(nullptr, tile);
+    EXPECT_EQ(a, tile->id);
+    EXPECT_FALSE(cache.has(a));
+    EXPECT_EQ(30u, manager.getBytes());
+    EXPECT_EQ(nullptr, cache.get(a));
+
+    // Adding a tile again makes it the newest, replacing the cached one.
+    cache.add(a, std::move(tile));
+    cache.add(b, std::make_unique<FakeTile>(b, 50));
+    EXPECT_EQ(80u, manager.getBytes());
+    cache.add(c, std::make_unique<FakeTile>(c, 30));
+    EXPECT_FALSE(cache.has(a));
+    EXPECT_TRUE(cache.has(b));
+
+    cache.clear();
+    EXPECT_FALSE(cache.has(b));
+    EXPECT_EQ(0u, manager.getBytes());
+}
+
+TEST(TileCache, CountLimit) {
+    TileMemoryManager manager(100);
+    TileCache cache;
+    cache.setManager(&manager);
+    cache.setSize(2);
+
+    cache.add(a, std::make_unique<FakeTile>(a, 1));
+    cache.add(b, std::make_unique<FakeTile>(b, 1));
+    cache.add(c, std::make_unique<FakeTile>(c, 1));
+    EXPECT_FALSE(cache.has(a));
+    EXPECT_TRUE(cache.has(b));
+    EXPECT_TRUE(cache.has(c));
+    EXPECT_EQ(2u, manager.getBytes());
+
+    cache.setSize(0);
+    EXPECT_FALSE(cache.has(b));
+    EXPECT_FALSE(cache.has(c));
+    cache.add(a, std::make_unique<FakeTile>(a, 1));
+    EXPECT_FALSE(cache.has(a));
+    EXPECT_EQ(0u, manager.getBytes());
+}
+
+TEST(TileCache, SharedBudget) {
+    TileMemoryManager manager(100);
+    TileCache streets;
+    TileCache satellite;
+    streets.setManager(&manager);
+    satellite.setManager(&manager);
+
+    streets.add(a, std::make_unique<FakeTile>(a, 30));
+    satellite.add(a, std::make_unique<FakeTile>(a, 30));
+    streets.add(b, std::make_unique<FakeTile>(b, 30));
+
+    // The coldest tile goes, whichever cache it is in.
+    satellite.add(b, std::make_unique<FakeTile>(b, 30));
+    EXPECT_FALSE(streets.has(a));
+    EXPECT_TRUE(satellite.has(a));
+    EXPECT_TRUE(streets.has(b));
+    EXPECT_TRUE(satellite.has(b));
+    EXPECT_EQ(90u, manager.getBytes());
+
+    satellite.add(c, std::make_unique<FakeTile>(c, 30));
+    EXPECT_FALSE(satellite.has(a));
+    EXPECT_EQ(30u, streets.getMemoryUsage().total());
+    EXPECT_EQ(60u, satellite.getMemoryUsage().total());
+
+    // Unregistering a cache drops its tiles, and frees up the budget.
+    satellite.setManager(nullptr);
+    EXPECT_FALSE(satellite.has(b));
+    EXPECT_EQ(30u, manager.getBytes());
+
+    // Caches that aren't registered don't keep tiles.
+    satellite.add(a, std::make_unique<FakeTile>(a, 30));
+    EXPECT_FALSE(satellite.has(a));
+}
+
+TEST(TileCache, Trim) {
+    TileMemoryManager manager(100);
+    TileCache cache;
+    cache.setManager(&manager);
+
+    cache.add(a, std::make_unique<FakeTile>(a, 30));
+    cache.add(b, std::make_unique<FakeTile>(b, 30));
+    cache.add(c, std::make_unique<FakeTile>(c, 30));
+
+    manager.trim(45);
+    EXPECT_FALSE(cache.has(a));
+    EXPECT_FALSE(cache.has(b));
+    EXPECT_TRUE(cache.has(c));
+    EXPECT_EQ(30u, manager.getBytes());
+
+    // The budget stays the same.
+    EXPECT_EQ(100u, manager.getMaxBytes());
+    cache.add(a, std::make_unique<FakeTile>(a, 30));
+    cache.add(b, std::make_unique<FakeTile>(b, 30));
+    EXPECT_EQ(90u, manager.getBytes());
+}
+
+TEST(TileCache, ReleaseMemory) {
+    TileMemoryManager manager(100);
+    TileCache cache;
+    cache.setManager(&manager);
+
+    cache.add(a, std::make_unique<FakeTile>(a, 40));
+    cache.add(b, std::make_unique<FakeTile>(b, 40));
+
+    cache.releaseMemory();
+    EXPECT_EQ(40u, cache.getMemoryUsage().cpu);
+    EXPECT_EQ(0u, cache.getMemoryUsage().gpu);
+    EXPECT_EQ(40u, manager.getBytes());
+
+    // The space that was freed up is available to other tiles.
+    cache.add(c, std::make_unique<FakeTile>(c, 60));
+    EXPECT_TRUE(cache.has(a));
+    EXPECT_TRUE(cache.has(b));
+    EXPECT_EQ(100u, manager.getBytes());
+
+    auto tile = cache.get(a);
+    ASSERT_NE(nullptr, tile);
+    EXPECT_TRUE(static_cast<FakeTile&>(*tile).gpuReleased);
+    EXPECT_TRUE(static_cast<FakeTile&>(*tile).featureIndexReleased);
+    EXPECT_EQ(80u, manager.getBytes());
+}
+
+TEST(TileCache, ReleaseGPUResources) {
+    TileMemoryManager manager(100);
+    TileCache cache;
+    cache.setManager(&manager);
+
+    cache.add(a, std::make_unique<FakeTile>(a, 40));
+    cache.add(b, std::make_unique<FakeTile>(b, 40));
+    cache.add(c, std::make_unique<FakeTile>(c, 20));
+
+    // The least recently cached tiles release theirs first, and only as many as needed.
+    EXPECT_EQ(20u, manager.releaseGPUResources(15));
+    EXPECT_EQ(80u, manager.getBytes());
+    EXPECT_EQ(30u, cache.getMemoryUsage().gpu);
+
+    // Tiles that already released theirs are skipped.
+    EXPECT_EQ(20u, manager.releaseGPUResources(15));
+    EXPECT_EQ(60u, manager.getBytes());
+
+    EXPECT_EQ(10u, manager.releaseGPUResources(100));
+    EXPECT_EQ(0u, manager.releaseGPUResources(100));
+    EXPECT_EQ(50u, manager.getBytes());
+    EXPECT_EQ(0u, cache.getMemoryUsage().gpu);
+
+    // Releasing GPU resources doesn't evict anything, nor touch the feature index.
+    auto tile = cache.get(b);
+    ASSERT_NE(nullptr, tile);
+    EXPECT_TRUE(static_cast<FakeTile&>(*tile).gpuReleased);
+    EXPECT_FALSE(static_cast<FakeTile&>(*tile).featureIndexReleased);
+    EXPECT_TRUE(cache.has(a));
+    EXPECT_TRUE(cache.has(c));
+}
+
+TEST(TileCache, ReleaseGPUResourcesShared) {
+    TileMemoryManager manager(100);
+    TileCache cache;
+    cache.setManager(&manager);
+
+    cache.add(a, std::make_unique<SharingTile>(a, 40, 10));
+    cache.add(b, std::make_unique<FakeTile>(b, 40));
+
+    // What a tile shares stays on the GPU, and the tile isn't asked again.
+    EXPECT_EQ(10u, manager.releaseGPUResources(5));
+    EXPECT_EQ(30u, cache.getMemoryUsage().gpu);
+    EXPECT_EQ(20u, manager.releaseGPUResources(100));
+    EXPECT_EQ(0u, manager.releaseGPUResources(100));
+    EXPECT_EQ(10u, cache.getMemoryUsage().gpu);
+}
+
+TEST(TileCache, InvalidateBuckets) {
+    TileMemoryManager manager(100);
+    TileCache cache;
+    cache.setManager(&manager);
+
+    cache.add(a, std::make_unique<FakeTile>(a, 10));
+    cache.add(b, std::make_unique<FakeTile>(b, 10));
+    cache.invalidateBuckets({ "water" });
+    cache.invalidateBuckets({ "water", "roads" });
+    cache.add(c, std::make_unique<FakeTile>(c, 10));
+
+    // Invalidations are merged, and only applied once the tile is retrieved.
+    auto tile = cache.get(a);
+    ASSERT_NE(nullptr, tile);
+    auto& fake = static_cast<FakeTile&>(*tile);
+    EXPECT_EQ(1u, fake.layouts);
+    EXPECT_EQ((std::unordered_set<std::string>{ "water", "roads" }), fake.invalidatedBuckets);
+
+    // Adding the tile again starts over.
+    fake.layouts = 0;
+    cache.add(a, std::move(tile));
+    EXPECT_EQ(0u, static_cast<FakeTile&>(*cache.get(a)).layouts);
+
+    // Tiles added after the invalidation keep their layout.
+    EXPECT_EQ(0u, static_cast<FakeTile&>(*cache.get(c)).layouts);
+    EXPECT_EQ(1u, static_cast<FakeTile&>(*cache.get(b)).layouts);
+}
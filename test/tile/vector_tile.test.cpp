@@ -1,15 +1,23 @@
 #include <mbgl/test/util.hpp>
 #include <mbgl/test/fake_file_source.hpp>
 #include <mbgl/tile/vector_tile.hpp>
+#include <mbgl/tile/vector_tile_data.hpp>
+#include <mbgl/tile/vector_tile_data_cache.hpp>
+#include <mbgl/tile/flat_geometry.hpp>
 #include <mbgl/tile/tile_loader_impl.hpp>
 
+#include <mbgl/util/compression.hpp>
+#include <mbgl/util/constants.hpp>
 #include <mbgl/util/default_thread_pool.hpp>
+#include <mbgl/util/io.hpp>
 #include <mbgl/util/run_loop.hpp>
 #include <mbgl/map/transform.hpp>
 #include <mbgl/style/style.hpp>
 #include <mbgl/style/update_parameters.hpp>
 #include <mbgl/annotation/annotation_manager.hpp>
 
+#include <protozero/pbf_writer.hpp>
+
 using namespace mbgl;
 
 class VectorTileTest {
@@ -21,6 +29,7 @@ public:
     AnnotationManager annotationManager { 1.0 };
     style::Style style { fileSource, 1.0 };
     Tileset tileset { { "https://example.com" }, { 0, 22 }, "none" };
+    VectorTileDataCache dataCache;
 
     style::UpdateParameters updateParameters {
         1.0,
@@ -36,14 +45,141 @@ public:
 
 TEST(VectorTile, setError) {
     VectorTileTest test;
-    VectorTile tile(OverscaledTileID(0, 0, 0), "source", test.updateParameters, test.tileset);
+    VectorTile tile(OverscaledTileID(0, 0, 0), "source", test.updateParameters, test.tileset, test.dataCache);
     tile.setError(std::make_exception_ptr(std::runtime_error("test")));
     EXPECT_FALSE(tile.isRenderable());
 }
 
 TEST(VectorTile, onError) {
     VectorTileTest test;
-    VectorTile tile(OverscaledTileID(0, 0, 0), "source", test.updateParameters, test.tileset);
+    VectorTile tile(OverscaledTileID(0, 0, 0), "source", test.updateParameters, test.tileset, test.dataCache);
     tile.onError(std::make_exception_ptr(std::runtime_error("test")));
     EXPECT_TRUE(tile.isRenderable());
 }
+
+TEST(VectorTile, LayerData) {
+    VectorTileData data(std::make_shared<std::string>(
+        util::read_file("test/fixtures/api/assets/streets/10-163-395.vector.pbf")));
+
+    EXPECT_EQ(nullptr, data.getLayer("missing"));
+
+    const GeometryTileLayer* layer = data.getLayer("place_label");
+    ASSERT_NE(nullptr, layer);
+    EXPECT_EQ(layer, data.getLayer("place_label"));
+    EXPECT_EQ("place_label", layer->getName());
+    EXPECT_EQ(29u, layer->featureCount());
+
+    auto feature = layer->getFeature(0);
+    EXPECT_EQ("San Francisco", feature->getValue("name")->get<std::string>());
+    EXPECT_EQ("city", feature->getProperties().at("type").get<std::string>());
+    EXPECT_FALSE(feature->getValue("missing"));
+
+    const GeometryTileLayer* road = data.getLayer("road");
+    ASSERT_NE(nullptr, road);
+    EXPECT_EQ(28u, road->featureCount());
+    EXPECT_FALSE(road->getFeature(0)->getGeometries().empty());
+}
+
+TEST(VectorTile, EachFeature) {
+    VectorTileData data(std::make_shared<std::string>(
+        util::read_file("test/fixtures/api/assets/streets/10-163-395.vector.pbf")));
+
+    // A single buffer is reused across features with different numbers of rings.
+    FlatGeometry geometry;
+    for (const auto& name : { "landcover", "water", "road", "place_label" }) {
+        const GeometryTileLayer* layer = data.getLayer(name);
+        ASSERT_NE(nullptr, layer);
+
+        std::size_t count = 0;
+        layer->eachFeature([&] (const GeometryTileFeature& feature, std::size_t i) {
+            EXPECT_EQ(count++, i);
+
+            auto expected = layer->getFeature(i);
+            EXPECT_EQ(expected->getType(), feature.getType());
+            EXPECT_EQ(expected->getID(), feature.getID());
+
+            feature.readGeometries(geometry);
+            EXPECT_EQ(expected->getGeometries(), geometry.toCollection());
+            return true;
+        });
+        EXPECT_EQ(layer->featureCount(), count);
+    }
+
+    std::size_t visited = 0;
+    data.getLayer("road")->eachFeature([&] (const GeometryTileFeature&, std::size_t) {
+        return ++visited < 3;
+    });
+    EXPECT_EQ(3u, visited);
+}
+
+namespace {
+
+// A tile with one layer of the given extent, holding a single two-point line.
+std::shared_ptr<const std::string> lineTile(uint32_t extent) {
+    std::string feature;
+    {
+        protozero::pbf_writer writer(feature);
+        writer.add_enum(3, 2); // LineString
+        // moveTo(10, 20), lineTo(5, 20)
+        const std::vector<uint32_t> geometry = { 9, 20, 40, 10, 9, 0 };
+        writer.add_packed_uint32(4, geometry.begin(), geometry.end());
+    }
+
+    std::string layer;
+    {
+        protozero::pbf_writer writer(layer);
+        writer.add_uint32(15, 2); // version
+        writer.add_string(1, "lines");
+        writer.add_message(2, feature);
+        writer.add_uint32(5, extent);
+    }
+
+    auto tile = std::make_shared<std::string>();
+    protozero::pbf_writer(*tile).add_message(3, layer);
+    return tile;
+}
+
+GeometryCollection lineGeometry(uint32_t extent) {
+    VectorTileData data(lineTile(extent));
+    return data.getLayer("lines")->getFeature(0)->getGeometries();
+}
+
+} // namespace
+
+TEST(VectorTile, GeometryExtent) {
+    EXPECT_EQ(GeometryCollection({ { { 10, 20 }, { 5, 20 } } }), lineGeometry(util::EXTENT));
+    EXPECT_EQ(GeometryCollection({ { { 20, 40 }, { 10, 40 } } }), lineGeometry(4096));
+    EXPECT_EQ(GeometryCollection({ { { 27, 55 }, { 14, 55 } } }), lineGeometry(3000));
+}
+
+TEST(VectorTile, CompressedData) {
+    // Tiles read from MBTiles packages are passed on compressed.
+    VectorTileData data(std::make_shared<std::string>(util::compress(*lineTile(util::EXTENT))));
+    EXPECT_EQ(GeometryCollection({ { { 10, 20 }, { 5, 20 } } }),
+              data.getLayer("lines")->getFeature(0)->getGeometries());
+}
+
+TEST(VectorTile, DataCache) {
+    VectorTileDataCache cache;
+    const std::string pbf = util::read_file("test/fixtures/api/assets/streets/10-163-395.vector.pbf");
+
+    // Overscaled tiles of the same canonical tile receive identical data in separate responses.
+    auto a = cache.get({ 10, 163, 395 }, std::make_shared<std::string>(pbf));
+    auto b = cache.get({ 10, 163, 395 }, std::make_shared<std::string>(pbf));
+    EXPECT_EQ(a.data, b.data);
+    EXPECT_EQ(a.buckets, b.buckets);
+    EXPECT_EQ(1u, cache.size());
+
+    // Other canonical tiles, and changed data, are parsed separately.
+    auto c = cache.get({ 10, 163, 396 }, std::make_shared<std::string>(pbf));
+    EXPECT_NE(a.data, c.data);
+    auto d = cache.get({ 10, 163, 395 }, lineTile(4096));
+    EXPECT_NE(a.data, d.data);
+    EXPECT_NE(a.buckets, d.buckets);
+    EXPECT_NE(nullptr, d.data->getLayer("lines"));
+    EXPECT_EQ(2u, cache.size());
+
+    // The cache doesn't keep data alive once no tile uses it.
+    a = b = c = d = {};
+    EXPECT_EQ(0u, cache.size());
+}
@@ -0,0 +1,70 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/util/byte_buffer.hpp>
+#include <mbgl/util/io.hpp>
+
+#include <stdexcept>
+
+using namespace mbgl;
+
+TEST(ByteBuffer, NullIsNotEmpty) {
+    ByteBuffer null;
+    EXPECT_FALSE(null);
+    EXPECT_TRUE(null.empty());
+
+    ByteBuffer empty { std::string() };
+    EXPECT_TRUE(empty);
+    EXPECT_TRUE(empty.empty());
+
+    EXPECT_NE(null, empty);
+    EXPECT_EQ(ByteBuffer(nullptr), null);
+}
+
+TEST(ByteBuffer, SharesString) {
+    auto string = std::make_shared<std::string>("Hello World!");
+    ByteBuffer buffer = string;
+    ByteBuffer copy = buffer;
+
+    EXPECT_EQ(string->data(), buffer.data());
+    EXPECT_EQ(string->data(), copy.data());
+    EXPECT_EQ(12u, copy.size());
+    EXPECT_EQ("Hello World!", copy.string());
+    EXPECT_EQ(3, string.use_count());
+}
+
+TEST(ByteBuffer, Slice) {
+    auto string = std::make_shared<std::string>("Hello World!");
+    ByteBuffer buffer = string;
+
+    ByteBuffer world = buffer.slice(6, 5);
+    EXPECT_EQ(buffer.data() + 6, world.data());
+    EXPECT_EQ("World", world.string());
+    EXPECT_EQ("orl", world.slice(1, 3).string());
+    EXPECT_TRUE(buffer.slice(12, 0).empty());
+
+    // The slice keeps the bytes alive.
+    buffer = nullptr;
+    string.reset();
+    EXPECT_EQ("World", world.string());
+
+    EXPECT_THROW(world.slice(6, 0), std::out_of_range);
+    EXPECT_THROW(world.slice(1, 5), std::out_of_range);
+}
+
+TEST(ByteBuffer, Equality) {
+    EXPECT_EQ(ByteBuffer(std::string("abc")), ByteBuffer(std::string("abc")));
+    EXPECT_NE(ByteBuffer(std::string("abc")), ByteBuffer(std::string("abd")));
+    EXPECT_NE(ByteBuffer(std::string("abc")), ByteBuffer(std::string("ab")));
+}
+
+TEST(ByteBuffer, MapFile) {
+    // Large enough to be mapped rather than read.
+    const std::string path = "test/fixtures/map/offline/0-0-0.vector.pbf";
+    const ByteBuffer mapped = util::map_file(path);
+    EXPECT_EQ(ByteBuffer(util::read_file(path)), mapped);
+
+    const ByteBuffer small = util::map_file("test/fixtures/storage/assets/nonempty");
+    EXPECT_EQ("content is here\n", small.string());
+
+    EXPECT_THROW(util::map_file("test/fixtures/storage/assets/does_not_exist"), std::runtime_error);
+}
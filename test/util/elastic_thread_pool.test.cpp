@@ -0,0 +1,147 @@
+#include <mbgl/actor/actor.hpp>
+#include <mbgl/util/elastic_thread_pool.hpp>
+
+#include <mbgl/test/util.hpp>
+
+#include <future>
+#include <thread>
+#include <vector>
+
+using namespace mbgl;
+
+namespace {
+
+// Polls `getThreadCount()` until it reaches `expected`, for up to a few seconds.
+bool waitForThreadCount(ElasticThreadPool& pool, std::size_t expected) {
+    for (auto i = 0; i < 500; ++i) {
+        if (pool.getThreadCount() == expected) {
+            return true;
+        }
+        std::this_thread::sleep_for(Milliseconds(10));
+    }
+    return false;
+}
+
+} // namespace
+
+TEST(ElasticThreadPool, OrderedMailboxes) {
+    struct Test {
+        int last = 0;
+        std::promise<void> promise;
+
+        Test(ActorRef<Test>, std::promise<void> promise_)
+            : promise(std::move(promise_)) {
+        }
+
+        void receive(int i) {
+            EXPECT_EQ(i, last + 1);
+            last = i;
+        }
+
+        void end() {
+            promise.set_value();
+        }
+    };
+
+    ElasticThreadPool pool { 1, 4 };
+
+    std::vector<std::future<void>> futures;
+    std::vector<std::unique_ptr<Actor<Test>>> actors;
+
+    for (auto i = 0; i < 16; ++i) {
+        std::promise<void> promise;
+        futures.push_back(promise.get_future());
+        actors.push_back(std::make_unique<Actor<Test>>(pool, std::move(promise)));
+    }
+
+    for (auto i = 1; i <= 100; ++i) {
+        for (auto& actor : actors) {
+            actor->invoke(&Test::receive, i);
+        }
+    }
+
+    for (auto& actor : actors) {
+        actor->invoke(&Test::end);
+    }
+
+    for (auto& future : futures) {
+        future.wait();
+    }
+}
+
+TEST(ElasticThreadPool, GrowsAndShrinks) {
+    // Each actor blocks its thread until released, so every one of them needs a thread
+    // of its own.
+
+    struct Test {
+        Test(ActorRef<Test>) {}
+
+        void block(std::promise<void> started, std::shared_future<void> release) {
+            started.set_value();
+            release.wait();
+        }
+    };
+
+    ElasticThreadPool pool { 1, 3, Milliseconds(20) };
+    EXPECT_EQ(1u, pool.getThreadCount());
+
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+
+    std::vector<std::future<void>> started;
+    std::vector<std::unique_ptr<Actor<Test>>> actors;
+    for (auto i = 0; i < 3; ++i) {
+        std::promise<void> promise;
+        started.push_back(promise.get_future());
+        actors.push_back(std::make_unique<Actor<Test>>(pool));
+        actors.back()->invoke(&Test::block, std::move(promise), released);
+    }
+
+    for (auto& future : started) {
+        future.wait();
+    }
+    EXPECT_EQ(3u, pool.getThreadCount());
+
+    release.set_value();
+    EXPECT_TRUE(waitForThreadCount(pool, 1));
+}
+
+TEST(ElasticThreadPool, MaxThreads) {
+    struct Test {
+        Test(ActorRef<Test>) {}
+
+        void block(std::shared_future<void> release, std::promise<void> done) {
+            release.wait();
+            done.set_value();
+        }
+    };
+
+    ElasticThreadPool pool { 0, 2 };
+    EXPECT_EQ(0u, pool.getThreadCount());
+    EXPECT_EQ(2u, pool.getConcurrency());
+
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+
+    std::vector<std::future<void>> done;
+    std::vector<std::unique_ptr<Actor<Test>>> actors;
+    for (auto i = 0; i < 8; ++i) {
+        std::promise<void> promise;
+        done.push_back(promise.get_future());
+        actors.push_back(std::make_unique<Actor<Test>>(pool));
+        actors.back()->invoke(&Test::block, released, std::move(promise));
+    }
+
+    EXPECT_EQ(2u, pool.getThreadCount());
+
+    release.set_value();
+    for (auto& future : done) {
+        future.wait();
+    }
+}
+
+TEST(ElasticThreadPool, Shared) {
+    auto a = ElasticThreadPool::shared();
+    auto b = ElasticThreadPool::shared();
+    EXPECT_EQ(a, b);
+}
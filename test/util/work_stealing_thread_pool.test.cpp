@@ -0,0 +1,91 @@
+#include <mbgl/actor/actor.hpp>
+#include <mbgl/util/work_stealing_thread_pool.hpp>
+
+#include <mbgl/test/util.hpp>
+
+#include <atomic>
+#include <future>
+#include <vector>
+
+using namespace mbgl;
+
+TEST(WorkStealingThreadPool, OrderedMailboxes) {
+    // Messages to each individual actor are processed in order, regardless of which
+    // worker ends up receiving them.
+
+    struct Test {
+        int last = 0;
+        std::promise<void> promise;
+
+        Test(ActorRef<Test>, std::promise<void> promise_)
+            : promise(std::move(promise_)) {
+        }
+
+        void receive(int i) {
+            EXPECT_EQ(i, last + 1);
+            last = i;
+        }
+
+        void end() {
+            promise.set_value();
+        }
+    };
+
+    WorkStealingThreadPool pool { 4 };
+    EXPECT_EQ(4u, pool.getConcurrency());
+
+    std::vector<std::future<void>> futures;
+    std::vector<std::unique_ptr<Actor<Test>>> actors;
+
+    for (auto i = 0; i < 16; ++i) {
+        std::promise<void> promise;
+        futures.push_back(promise.get_future());
+        actors.push_back(std::make_unique<Actor<Test>>(pool, std::move(promise)));
+    }
+
+    for (auto i = 1; i <= 100; ++i) {
+        for (auto& actor : actors) {
+            actor->invoke(&Test::receive, i);
+        }
+    }
+
+    for (auto& actor : actors) {
+        actor->invoke(&Test::end);
+    }
+
+    for (auto& future : futures) {
+        future.wait();
+    }
+}
+
+TEST(WorkStealingThreadPool, SelfSend) {
+    // Messages an actor sends to itself from a worker thread are scheduled on the
+    // same pool and eventually processed.
+
+    struct Test {
+        ActorRef<Test> self;
+        std::promise<void> promise;
+
+        Test(ActorRef<Test> self_, std::promise<void> promise_)
+            : self(std::move(self_)),
+              promise(std::move(promise_)) {
+        }
+
+        void countdown(int remaining) {
+            if (remaining == 0) {
+                promise.set_value();
+            } else {
+                self.invoke(&Test::countdown, remaining - 1);
+            }
+        }
+    };
+
+    WorkStealingThreadPool pool { 2 };
+
+    std::promise<void> endedPromise;
+    std::future<void> endedFuture = endedPromise.get_future();
+    Actor<Test> test(pool, std::move(endedPromise));
+
+    test.invoke(&Test::countdown, 1000);
+    endedFuture.wait();
+}